@@ -0,0 +1,1561 @@
+/**
+ * @file     bench.cpp
+ * @brief    基准测试（cmake -DBENCH=XXX 选择测试项，替换默认演示任务）
+ * @date     2026-10-17
+ *
+ * @note     多线程扩展测试按线程数运行多次：
+ *           for n in 1 2 4 8; do COROUTINE_THREADS=$n ./LibCoroutine; done
+ *           Yield 饥饿检查按控制器数运行(每秒都应输出报告，sleeps 不应为 0)：
+ *           for n in 1 2 3 4; do COROUTINE_THREADS=$n ./LibCoroutine; done
+ *           硬亲和检查(violations 应始终为 0，flips 不应为 0)：
+ *           for n in 2 4; do COROUTINE_THREADS=$n ./LibCoroutine; done
+ *           超时抖动测试对比休眠列表实现：
+ *           cmake -DBENCH=TIMER -DCMAKE_C_FLAGS=-DCOROUTINE_SLEEP_WHEEL=0
+ *           唤醒延迟测试对比共享条件变量：
+ *           cmake -DBENCH=WAKE -DCMAKE_CXX_FLAGS=-DPORT_PARK=0
+ *           获取当前任务测试对比按线程id查找：
+ *           cmake -DBENCH=CURRENT -DCMAKE_C_FLAGS=-DCOROUTINE_THREAD_LOCAL=0
+ *           跨控制器唤醒测试对比加锁加入就绪队列(需要 9 个控制器)：
+ *           cmake -DBENCH=INBOX -DCMAKE_C_FLAGS=-DCOROUTINE_WAKE_INBOX=0 -DCMAKE_CXX_FLAGS=-DCOROUTINE_WAKE_INBOX=0
+ *           COROUTINE_THREADS=9 ./LibCoroutine
+ *           多调度实例测试(控制器总数相同，1 个共享实例对比 2 个独立实例，lost 应为 0)：
+ *           cmake -DBENCH=INSTANCE -DCMAKE_C_FLAGS=-DCOROUTINE_MULTI_INSTANCE=1 -DCMAKE_CXX_FLAGS=-DCOROUTINE_MULTI_INSTANCE=1
+ *           for n in 1 2; do BENCH_INSTANCES=$n COROUTINE_THREADS=4 ./LibCoroutine; done
+ *           NUMA 分组检查(模拟节点，errors 应为 0，remote 应远少于 local，输出 PASS；默认使用精确时钟)：
+ *           for n in 2 3; do COROUTINE_NUMA_FAKE=$n COROUTINE_THREADS=$((n * 2)) ./LibCoroutine; done
+ *           互斥锁竞争测试对比不自旋直接挂起：
+ *           cmake -DBENCH=MUTEX -DCMAKE_C_FLAGS=-DCOROUTINE_MUTEX_SPIN=0 -DCMAKE_CXX_FLAGS=-DCOROUTINE_MUTEX_SPIN=0
+ *           优先级反转测试对比不继承优先级(高优先级任务等待被中优先级任务拖住)：
+ *           cmake -DBENCH=INHERIT -DCMAKE_C_FLAGS=-DCOROUTINE_MUTEX_INHERIT=0 -DCMAKE_CXX_FLAGS=-DCOROUTINE_MUTEX_INHERIT=0
+ *           任务都固定在控制器 0(stray 应为 0)；COROUTINE_THREADS=1 排除其他控制器线程占用 CPU 的干扰
+ *           读写锁测试按控制器数运行，对比互斥锁(BENCH_RWLOCK_MUTEX=1)：
+ *           for n in 1 2 4 8; do COROUTINE_THREADS=$n ./LibCoroutine; BENCH_RWLOCK_MUTEX=1 COROUTINE_THREADS=$n ./LibCoroutine; done
+ *           读写锁用法检查：BENCH_RWLOCK_CHECK=1 递归读/升级，BENCH_RWLOCK_CHECK=2 释放没有持有的锁(应报告错误)
+ *           事件组测试按无关等待者数量运行(置位只检查对应位的等待者，往返速率不随之下降)：
+ *           for n in 0 1000 4000; do BENCH_EVENT_IDLE=$n ./LibCoroutine; done
+ *           事件组消费检查按控制器数运行(over、lost 应始终为 0)：
+ *           for n in 2 4 8; do COROUTINE_THREADS=$n ./LibCoroutine; done
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sched.h>
+#include <string.h>
+#include "Coroutine.h"
+#if BENCH_RWLOCK
+#include "Coroutine.hpp"
+#endif
+#if BENCH_NUMA
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// 上下文切换：通道乒乓，统计每次切换耗时
+#ifndef BENCH_SWITCH
+#define BENCH_SWITCH 0
+#endif
+
+// 多线程扩展：大量 Yield 任务，统计全部控制器每秒切换次数
+#ifndef BENCH_SCALE
+#define BENCH_SCALE 0
+#endif
+
+// Yield 饥饿：忙任务被同时释放后只 Yield 不阻塞，统计休眠任务每秒到期唤醒次数和报告任务的延迟
+#ifndef BENCH_STARVE
+#define BENCH_STARVE 0
+#endif
+
+// 硬亲和：固定在控制器上的任务(忙等、被其他控制器唤醒、运行中切换掩码)只在掩码中的控制器运行
+#ifndef BENCH_AFFINITY
+#define BENCH_AFFINITY 0
+#endif
+
+// 任务创建/退出：批量创建立即结束的任务，统计每秒创建数
+#ifndef BENCH_SPAWN
+#define BENCH_SPAWN 0
+#endif
+
+// 超时抖动：大量带超时等待，多数被提前唤醒(插入+取消)，少数超时(到期)
+#ifndef BENCH_TIMER
+#define BENCH_TIMER 0
+#endif
+
+// 唤醒偏差：大量任务休眠到同一时刻，统计实际唤醒时间与到期时间的偏差
+#ifndef BENCH_SKEW
+#define BENCH_SKEW 0
+#endif
+
+// 唤醒延迟：控制器空闲时外部线程 GiveSemaphore 到等待任务开始运行的时间
+#ifndef BENCH_WAKE
+#define BENCH_WAKE 0
+#endif
+
+// 获取当前任务：GetCurrentTaskId 和 Yield 单次耗时
+#ifndef BENCH_CURRENT
+#define BENCH_CURRENT 0
+#endif
+
+// 任务分配：按各分配策略批量创建任务，统计各控制器首次运行的任务数(包含窃取的结果)
+#ifndef BENCH_PLACE
+#define BENCH_PLACE 0
+#endif
+
+// 跨控制器唤醒：8 个生产者控制器同时唤醒控制器 0 上的任务，统计每秒唤醒次数
+#ifndef BENCH_INBOX
+#define BENCH_INBOX 0
+#endif
+
+// 多调度实例：分片负载(信号量乒乓 + 短休眠)放在 1 个共享实例或 2 个独立实例，统计总吞吐
+#ifndef BENCH_INSTANCE
+#define BENCH_INSTANCE 0
+#endif
+
+// NUMA 分组：模拟多个节点，检查控制器分组、线程绑定、栈绑定，统计任务在本节点/跨节点间的迁移
+#ifndef BENCH_NUMA
+#define BENCH_NUMA 0
+#endif
+
+// 互斥锁竞争：多个任务争用同一把锁，按临界区长度逐档统计每秒加锁次数
+#ifndef BENCH_MUTEX
+#define BENCH_MUTEX 0
+#endif
+
+// 优先级反转：低优先级持锁，中优先级占满控制器，统计高优先级任务获取锁的等待时间
+#ifndef BENCH_INHERIT
+#define BENCH_INHERIT 0
+#endif
+
+// 读写锁：大量读者 + 少量写者访问共享表，统计每秒读次数(对比互斥锁)
+#ifndef BENCH_RWLOCK
+#define BENCH_RWLOCK 0
+#endif
+
+// 事件组：成对任务按各自的位往返置位/等待，另有等待其他位的无关任务
+#ifndef BENCH_EVENT
+#define BENCH_EVENT 0
+#endif
+
+// 事件组消费：多个置位者和清除等待者(挂起等待和不等待的快速路径)并发，每一次 0→1 置位只能被消费一次
+#ifndef BENCH_EVENT_CONSUME
+#define BENCH_EVENT_CONSUME 0
+#endif
+
+#if defined(COROUTINE_CONTEXT_MODE)
+#define BENCH_CONTEXT_MODE COROUTINE_CONTEXT_MODE
+#else
+#define BENCH_CONTEXT_MODE 0   // 平台默认
+#endif
+
+__attribute__((unused)) static uint64_t GetNanosecond(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// --------------------------------------------------------------------------------------
+//                              |       上下文切换        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_SWITCH
+#define SWITCH_PAIRS 1   // 乒乓任务对数
+
+static void Bench_Switch_1(void *obj)
+{
+    Coroutine_Channel ch    = (Coroutine_Channel)obj;
+    uint64_t          num   = 0;
+    uint64_t          start = GetNanosecond();
+    while (true) {
+        Coroutine.WriteChannel(ch, num + 1, UINT32_MAX);
+        Coroutine.ReadChannel(ch, &num, UINT32_MAX);
+        uint64_t tv = GetNanosecond() - start;
+        if (tv >= 1000000000ULL) {
+            // 每轮往返两次切换
+            printf("[bench switch] mode %d rounds %llu %llu ns/switch\n",
+                   BENCH_CONTEXT_MODE,
+                   (unsigned long long)num,
+                   (unsigned long long)(num == 0 ? 0 : tv / (num * 2)));
+            num   = 0;
+            start = GetNanosecond();
+        }
+    }
+}
+
+static void Bench_Switch_2(void *obj)
+{
+    Coroutine_Channel ch  = (Coroutine_Channel)obj;
+    uint64_t          num = 0;
+    while (true) {
+        Coroutine.ReadChannel(ch, &num, UINT32_MAX);
+        Coroutine.WriteChannel(ch, num + 1, UINT32_MAX);
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       多线程扩展        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_SCALE
+#define SCALE_TASKS 64   // 任务数量
+
+static volatile uint64_t scale_count[SCALE_TASKS];
+
+static void Bench_Scale_Task(void *obj)
+{
+    volatile uint64_t *count = (volatile uint64_t *)obj;
+    while (true) {
+        (*count)++;
+        Coroutine.Yield();
+    }
+}
+
+static void Bench_Scale_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    uint64_t                      last  = 0;
+    uint64_t                      start = GetNanosecond();
+    while (true) {
+        Coroutine.YieldDelay(1000);
+        uint64_t total = 0;
+        for (int i = 0; i < SCALE_TASKS; i++)
+            total += scale_count[i];
+        uint64_t now = GetNanosecond();
+        printf("[bench scale] threads %u tasks %d %llu yield/s\n",
+               (unsigned)GetInter()->thread_count,
+               SCALE_TASKS,
+               (unsigned long long)((total - last) * 1000000000ULL / (now - start)));
+        last  = total;
+        start = now;
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       Yield 饥饿        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_STARVE
+#define STARVE_BUSY     16   // 忙任务数
+#define STARVE_SLEEPERS 16   // 休眠任务数
+#define STARVE_SLEEP_MS 10   // 休眠时间 ms
+
+static Coroutine_Semaphore starve_start;
+static volatile uint64_t   starve_yields;
+static volatile uint64_t   starve_sleeps;
+
+static void Bench_Starve_Busy(void *obj)
+{
+    Coroutine.WaitSemaphore(starve_start, 1, UINT32_MAX);
+    while (true) {
+        __atomic_fetch_add(&starve_yields, 1, __ATOMIC_RELAXED);
+        Coroutine.Yield();
+    }
+}
+
+static void Bench_Starve_Sleeper(void *obj)
+{
+    while (true) {
+        Coroutine.YieldDelay(STARVE_SLEEP_MS);
+        __atomic_fetch_add(&starve_sleeps, 1, __ATOMIC_RELAXED);
+    }
+}
+
+static void Bench_Starve_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    uint64_t                      yields = 0, sleeps = 0;
+    // 忙任务已全部挂起，一次性释放(集中加入当前控制器的就绪队列)
+    Coroutine.YieldDelay(100);
+    Coroutine.GiveSemaphore(starve_start, STARVE_BUSY);
+    while (true) {
+        uint64_t start = GetNanosecond();
+        Coroutine.YieldDelay(1000);
+        uint64_t tv = GetNanosecond() - start;
+        printf("[bench starve] controllers %u yields %llu/s sleeps %llu/s report late %llu ms\n",
+               (unsigned)GetInter()->thread_count,
+               (unsigned long long)((starve_yields - yields) * 1000000000ULL / tv),
+               (unsigned long long)((starve_sleeps - sleeps) * 1000000000ULL / tv),
+               (unsigned long long)(tv / 1000000 - 1000));
+        yields = starve_yields;
+        sleeps = starve_sleeps;
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       硬亲和        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_AFFINITY
+#define AFFINITY_TASKS 1   // 每组任务数(每个控制器上只有一个固定任务时最容易暴露问题)
+
+static Coroutine_Semaphore affinity_sem, affinity_ack;
+static volatile uint64_t   affinity_runs;
+static volatile uint64_t   affinity_violations;
+static volatile uint64_t   affinity_flips;
+
+// 检查当前控制器是否在掩码中
+static void Bench_Affinity_Check(Coroutine_Affinity mask)
+{
+    uint16_t idx = Coroutine.GetCurrentCoroutineIdx();
+    __atomic_fetch_add(&affinity_runs, 1, __ATOMIC_RELAXED);
+    if (idx >= COROUTINE_AFFINITY_BITS || ((mask >> idx) & 1) == 0)
+        __atomic_fetch_add(&affinity_violations, 1, __ATOMIC_RELAXED);
+}
+
+static Coroutine_Affinity Bench_Affinity_Last(void)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    return (Coroutine_Affinity)1 << (GetInter()->thread_count - 1);
+}
+
+// 忙等：固定在控制器 0，只 Yield
+static void Bench_Affinity_Busy(void *obj)
+{
+    Coroutine.SetTaskAffinity(nullptr, 1, true);
+    while (true) {
+        Bench_Affinity_Check(1);
+        Coroutine.Yield();
+    }
+}
+
+// 被唤醒：固定在最后一个控制器，与不限制的任务乒乓(双方都挂起等待)
+static void Bench_Affinity_Waiter(void *obj)
+{
+    Coroutine_Affinity mask = Bench_Affinity_Last();
+    Coroutine.SetTaskAffinity(nullptr, mask, true);
+    while (true) {
+        Coroutine.WaitSemaphore(affinity_sem, 1, UINT32_MAX);
+        Bench_Affinity_Check(mask);
+        Coroutine.GiveSemaphore(affinity_ack, 1);
+    }
+}
+
+static void Bench_Affinity_Giver(void *obj)
+{
+    while (true) {
+        Coroutine.GiveSemaphore(affinity_sem, 1);
+        Coroutine.WaitSemaphore(affinity_ack, 1, UINT32_MAX);
+    }
+}
+
+// 运行中切换掩码：设置返回时应已在新掩码的控制器上
+static void Bench_Affinity_Flip(void *obj)
+{
+    Coroutine_Affinity masks[2] = {1, Bench_Affinity_Last()};
+    for (uint32_t n = 0;; n++) {
+        Coroutine_Affinity mask = masks[n & 1];
+        Coroutine.SetTaskAffinity(nullptr, mask, true);
+        __atomic_fetch_add(&affinity_flips, 1, __ATOMIC_RELAXED);
+        for (int i = 0; i < 100; i++) {
+            Bench_Affinity_Check(mask);
+            Coroutine.Yield();
+        }
+    }
+}
+
+static void Bench_Affinity_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    while (true) {
+        Coroutine.YieldDelay(1000);
+        printf("[bench affinity] controllers %u runs %llu flips %llu violations %llu\n",
+               (unsigned)GetInter()->thread_count,
+               (unsigned long long)affinity_runs,
+               (unsigned long long)affinity_flips,
+               (unsigned long long)affinity_violations);
+        affinity_runs       = 0;
+        affinity_flips      = 0;
+        affinity_violations = 0;
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       任务创建/退出        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_SPAWN
+#define SPAWN_BATCH 100   // 每批任务数
+
+static void Bench_Spawn_Child(void *obj)
+{
+    Coroutine.GiveSemaphore((Coroutine_Semaphore)obj, 1);
+}
+
+static void Bench_Spawn(void *obj)
+{
+    Coroutine_Semaphore sem   = Coroutine.CreateSemaphore("bench-spawn", 0);
+    uint64_t            num   = 0;
+    uint64_t            start = GetNanosecond();
+    while (true) {
+        for (int i = 0; i < SPAWN_BATCH; i++)
+            Coroutine.AddTask(Bench_Spawn_Child, sem, TASK_PRI_NORMAL, 0, "Spawn-Child", nullptr);
+        Coroutine.WaitSemaphore(sem, SPAWN_BATCH, UINT32_MAX);
+        num += SPAWN_BATCH;
+        uint64_t tv = GetNanosecond() - start;
+        if (tv >= 1000000000ULL) {
+            printf("[bench spawn] tasks %llu %llu spawn+exit/s %llu ns/task\n",
+                   (unsigned long long)num,
+                   (unsigned long long)(num * 1000000000ULL / tv),
+                   (unsigned long long)(tv / num));
+            num   = 0;
+            start = GetNanosecond();
+        }
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       超时抖动        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_TIMER
+#define TIMER_TASKS 1000   // 等待任务数量
+
+static Coroutine_Semaphore timer_sem[TIMER_TASKS];
+static volatile uint64_t   timer_wait[TIMER_TASKS];
+static volatile uint64_t   timer_timeout[TIMER_TASKS];
+static volatile bool       timer_waiting[TIMER_TASKS];
+
+static void Bench_Timer_Wait(void *obj)
+{
+    int      idx  = (int)(intptr_t)obj;
+    uint32_t seed = 0x9E3779B9u * (idx + 1);
+    while (true) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        // 超时 1~20ms
+        timer_waiting[idx] = true;
+        if (!Coroutine.WaitSemaphoreUs(timer_sem[idx], 1, 1000 + seed % 19000))
+            timer_timeout[idx]++;
+        timer_waiting[idx] = false;
+        timer_wait[idx]++;
+    }
+}
+
+static void Bench_Timer_Give(void *obj)
+{
+    uint32_t seed = 12345;
+    while (true) {
+        for (int i = 0; i < 16; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            int idx = seed % TIMER_TASKS;
+            if (timer_waiting[idx]) {
+                // 只唤醒正在等待的任务，保证每次等待都经过休眠列表
+                timer_waiting[idx] = false;
+                Coroutine.GiveSemaphore(timer_sem[idx], 1);
+            }
+        }
+        Coroutine.Yield();
+    }
+}
+
+static void Bench_Timer_Report(void *obj)
+{
+    uint64_t last = 0, last_timeout = 0;
+    uint64_t start = GetNanosecond();
+    while (true) {
+        Coroutine.YieldDelay(1000);
+        uint64_t total = 0, timeout = 0;
+        for (int i = 0; i < TIMER_TASKS; i++) {
+            total += timer_wait[i];
+            timeout += timer_timeout[i];
+        }
+        uint64_t now = GetNanosecond();
+        printf("[bench timer] wheel %d tasks %d %llu wait/s %llu timeout/s\n",
+               COROUTINE_SLEEP_WHEEL,
+               TIMER_TASKS,
+               (unsigned long long)((total - last) * 1000000000ULL / (now - start)),
+               (unsigned long long)((timeout - last_timeout) * 1000000000ULL / (now - start)));
+        last         = total;
+        last_timeout = timeout;
+        start        = now;
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       唤醒偏差        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_SKEW
+#define SKEW_TASKS 1000   // 同时到期任务数量
+#define SKEW_DELAY 20000  // 休眠时间 us
+
+static Coroutine_Semaphore skew_start, skew_done;
+static volatile uint64_t   skew_deadline;
+static volatile uint64_t   skew_late[SKEW_TASKS];
+
+static void Bench_Skew_Task(void *obj)
+{
+    int idx = (int)(intptr_t)obj;
+    while (true) {
+        Coroutine.WaitSemaphore(skew_start, 1, UINT32_MAX);
+        uint64_t deadline = skew_deadline;
+        uint64_t now      = Coroutine.GetMicrosecond();
+        if (deadline > now)
+            Coroutine.YieldDelayUs(deadline - now);
+        skew_late[idx] = Coroutine.GetMicrosecond() - deadline;
+        Coroutine.GiveSemaphore(skew_done, 1);
+    }
+}
+
+static void Bench_Skew_Report(void *obj)
+{
+    while (true) {
+        Coroutine.YieldDelay(1000);
+        skew_deadline = Coroutine.GetMicrosecond() + SKEW_DELAY;
+        Coroutine.GiveSemaphore(skew_start, SKEW_TASKS);
+        Coroutine.WaitSemaphore(skew_done, SKEW_TASKS, UINT32_MAX);
+        uint64_t min = UINT64_MAX, max = 0, sum = 0;
+        for (int i = 0; i < SKEW_TASKS; i++) {
+            if (skew_late[i] < min) min = skew_late[i];
+            if (skew_late[i] > max) max = skew_late[i];
+            sum += skew_late[i];
+        }
+        printf("[bench skew] tasks %d late min %llu avg %llu max %llu us skew %llu us\n",
+               SKEW_TASKS,
+               (unsigned long long)min,
+               (unsigned long long)(sum / SKEW_TASKS),
+               (unsigned long long)max,
+               (unsigned long long)(max - min));
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       唤醒延迟        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_WAKE
+static Coroutine_Semaphore wake_sem;
+static volatile uint64_t   wake_start;
+static volatile uint64_t   wake_end;
+
+// 外部线程释放信号量，控制器全部空闲时测量唤醒延迟
+static void *Bench_Wake_Give(void *obj)
+{
+    struct timespec tv  = {0, 500000};   // 500us，等待控制器进入空闲
+    uint64_t        num = 0, total = 0, max = 0;
+    uint64_t        start = GetNanosecond();
+    while (true) {
+        nanosleep(&tv, NULL);
+        wake_end   = 0;
+        wake_start = GetNanosecond();
+        Coroutine.GiveSemaphore(wake_sem, 1);
+        while (wake_end == 0)
+            sched_yield();
+        uint64_t lat = wake_end - wake_start;
+        total += lat;
+        if (lat > max) max = lat;
+        num++;
+        if (GetNanosecond() - start >= 1000000000ULL) {
+            printf("[bench wake] rounds %llu avg %llu ns max %llu ns\n",
+                   (unsigned long long)num,
+                   (unsigned long long)(total / num),
+                   (unsigned long long)max);
+            num = total = max = 0;
+            start = GetNanosecond();
+        }
+    }
+    return nullptr;
+}
+
+static void Bench_Wake_Wait(void *obj)
+{
+    while (true) {
+        Coroutine.WaitSemaphore(wake_sem, 1, UINT32_MAX);
+        wake_end = GetNanosecond();
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       获取当前任务        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_CURRENT
+#define CURRENT_LOOPS 1000000   // 每轮调用次数
+
+static void Bench_Current(void *obj)
+{
+    while (true) {
+        Coroutine_TaskId id    = nullptr;
+        uint64_t         start = GetNanosecond();
+        for (int i = 0; i < CURRENT_LOOPS; i++)
+            id = Coroutine.GetCurrentTaskId();
+        uint64_t tv_id = GetNanosecond() - start;
+        start          = GetNanosecond();
+        for (int i = 0; i < CURRENT_LOOPS; i++)
+            Coroutine.Yield();
+        uint64_t tv_yield = GetNanosecond() - start;
+        printf("[bench current] tls %d task %p GetCurrentTaskId %llu ns Yield %llu ns\n",
+               COROUTINE_THREAD_LOCAL,
+               id,
+               (unsigned long long)(tv_id / CURRENT_LOOPS),
+               (unsigned long long)(tv_yield / CURRENT_LOOPS));
+        Coroutine.YieldDelay(500);
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       任务分配        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_PLACE
+#define PLACE_BURST   256   // 每批任务数
+#define PLACE_THREADS 64    // 统计的最大控制器数
+
+static volatile uint32_t place_count[PLACE_THREADS];
+
+static void Bench_Place_Child(void *obj)
+{
+    uint16_t idx = Coroutine.GetCurrentCoroutineIdx();
+    if (idx < PLACE_THREADS) place_count[idx]++;
+    for (int i = 0; i < 20; i++)
+        Coroutine.Yield();
+    Coroutine.GiveSemaphore((Coroutine_Semaphore)obj, 1);
+}
+
+static void Bench_Place(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    static const char *           names[] = {"default", "round-robin", "two-choice", "local"};
+    Coroutine_Semaphore           sem     = Coroutine.CreateSemaphore("bench-place", 0);
+    size_t                        num     = GetInter()->thread_count;
+    if (num > PLACE_THREADS) num = PLACE_THREADS;
+    while (true) {
+        for (int p = CO_PLACE_ROUND_ROBIN; p <= CO_PLACE_LOCAL; p++) {
+            memset((void *)place_count, 0, sizeof(place_count));
+            uint64_t start = GetNanosecond();
+            for (int i = 0; i < PLACE_BURST; i++)
+                Coroutine.AddTaskPlacement(Bench_Place_Child, sem, TASK_PRI_NORMAL, 0, "Place-Child", (Coroutine_Placement_t)p, nullptr);
+            Coroutine.WaitSemaphore(sem, PLACE_BURST, UINT32_MAX);
+            uint64_t tv  = GetNanosecond() - start;
+            uint32_t max = 0;
+            char     buf[256];
+            int      len = 0;
+            for (size_t i = 0; i < num; i++) {
+                if (place_count[i] > max) max = place_count[i];
+                len += snprintf(buf + len, sizeof(buf) - len, " %u", place_count[i]);
+            }
+            printf("[bench place] %-11s burst %d per-controller%s max/avg %.2f %llu ns/task\n",
+                   names[p],
+                   PLACE_BURST,
+                   buf,
+                   max * (double)num / PLACE_BURST,
+                   (unsigned long long)(tv / PLACE_BURST));
+        }
+        Coroutine.YieldDelay(1000);
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       跨控制器唤醒        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_INBOX
+#define INBOX_PRODUCERS 8   // 生产者数(各占一个控制器)
+#define INBOX_DEPTH     8   // 每个生产者同时唤醒的消费者数
+
+static Coroutine_Semaphore inbox_req[INBOX_PRODUCERS][INBOX_DEPTH];
+static Coroutine_Semaphore inbox_ack[INBOX_PRODUCERS];
+static volatile uint64_t   inbox_count[INBOX_PRODUCERS];
+
+// 消费者固定在控制器 0，由生产者唤醒后应答
+static void Bench_Inbox_Consumer(void *obj)
+{
+    intptr_t idx = (intptr_t)obj;
+    Coroutine.SetTaskAffinity(nullptr, 1, true);
+    while (true) {
+        Coroutine.WaitSemaphore(inbox_req[idx / INBOX_DEPTH][idx % INBOX_DEPTH], 1, UINT32_MAX);
+        Coroutine.GiveSemaphore(inbox_ack[idx / INBOX_DEPTH], 1);
+    }
+}
+
+// 生产者固定在控制器 1..n-1，每轮唤醒 INBOX_DEPTH 个消费者并等待全部应答
+static void Bench_Inbox_Producer(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    intptr_t                      idx = (intptr_t)obj;
+    size_t                        num = GetInter()->thread_count;
+    if (num > 1)
+        Coroutine.SetTaskAffinity(nullptr, (Coroutine_Affinity)1 << (1 + idx % (num - 1)), true);
+    while (true) {
+        for (int i = 0; i < INBOX_DEPTH; i++)
+            Coroutine.GiveSemaphore(inbox_req[idx][i], 1);
+        Coroutine.WaitSemaphore(inbox_ack[idx], INBOX_DEPTH, UINT32_MAX);
+        inbox_count[idx] += INBOX_DEPTH;
+    }
+}
+
+static void Bench_Inbox_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    uint64_t                      last = 0;
+    while (true) {
+        uint64_t start = GetNanosecond();
+        Coroutine.YieldDelay(1000);
+        uint64_t total = 0;
+        for (int i = 0; i < INBOX_PRODUCERS; i++)
+            total += inbox_count[i];
+        uint64_t tv = GetNanosecond() - start;
+        printf("[bench inbox] inbox %d controllers %u producers %d wakes %llu/s\n",
+               COROUTINE_WAKE_INBOX,
+               (unsigned)GetInter()->thread_count,
+               INBOX_PRODUCERS,
+               (unsigned long long)((total - last) * 1000000000ULL / tv));
+        last = total;
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       多调度实例        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_INSTANCE
+#if !COROUTINE_MULTI_INSTANCE
+#error "BENCH_INSTANCE requires COROUTINE_MULTI_INSTANCE=1"
+#endif
+#define INSTANCE_SHARDS   8    // 分片数(按实例数轮流放置)
+#define INSTANCE_PAIRS    4    // 每个分片的乒乓任务对数
+#define INSTANCE_SLEEPERS 16   // 每个分片的短休眠任务数
+
+static Coroutine_Semaphore inst_ping[INSTANCE_SHARDS][INSTANCE_PAIRS];
+static Coroutine_Semaphore inst_pong[INSTANCE_SHARDS][INSTANCE_PAIRS];
+static volatile uint64_t   inst_rounds[INSTANCE_SHARDS];
+static volatile uint64_t   inst_sleeps[INSTANCE_SHARDS];
+static volatile uint32_t   inst_lost;   // 切换实例再切回后找不到当前任务的次数
+
+static void Bench_Instance_Ping(void *obj)
+{
+    intptr_t idx = (intptr_t)obj;
+    while (true) {
+        Coroutine.GiveSemaphore(inst_ping[idx / INSTANCE_PAIRS][idx % INSTANCE_PAIRS], 1);
+        Coroutine.WaitSemaphore(inst_pong[idx / INSTANCE_PAIRS][idx % INSTANCE_PAIRS], 1, UINT32_MAX);
+        inst_rounds[idx / INSTANCE_PAIRS]++;
+        // 临时切到默认实例再切回，控制器缓存应保留
+        Coroutine.SelectInstance(Coroutine.SelectInstance(nullptr));
+        if (Coroutine.GetCurrentTaskId() == nullptr)
+            __atomic_fetch_add(&inst_lost, 1, __ATOMIC_RELAXED);
+    }
+}
+
+static void Bench_Instance_Pong(void *obj)
+{
+    intptr_t idx = (intptr_t)obj;
+    while (true) {
+        Coroutine.WaitSemaphore(inst_ping[idx / INSTANCE_PAIRS][idx % INSTANCE_PAIRS], 1, UINT32_MAX);
+        Coroutine.GiveSemaphore(inst_pong[idx / INSTANCE_PAIRS][idx % INSTANCE_PAIRS], 1);
+    }
+}
+
+static void Bench_Instance_Sleep(void *obj)
+{
+    intptr_t shard = (intptr_t)obj;
+    while (true) {
+        Coroutine.YieldDelayUs(200);
+        inst_sleeps[shard]++;
+    }
+}
+
+// 实例的控制器线程
+static void *Bench_Instance_Run(void *obj)
+{
+    extern void PinThread(void);
+    Coroutine.SelectInstance((Coroutine_Instance)obj);
+    PinThread();
+    while (true)
+        Coroutine.RunTick(UINT32_MAX);
+    return nullptr;
+}
+
+static void *Bench_Instance_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    struct timespec               tv     = {1, 0};
+    uint64_t                      rounds = 0, sleeps = 0;
+    uint64_t                      start  = GetNanosecond();
+    while (true) {
+        nanosleep(&tv, NULL);
+        uint64_t r = 0, s = 0;
+        for (int i = 0; i < INSTANCE_SHARDS; i++) {
+            r += inst_rounds[i];
+            s += inst_sleeps[i];
+        }
+        uint64_t now = GetNanosecond();
+        printf("[bench instance] instances %d controllers %u shards %d pingpong %llu/s sleep %llu/s lost %u\n",
+               (int)(intptr_t)obj,
+               (unsigned)GetInter()->thread_count,
+               INSTANCE_SHARDS,
+               (unsigned long long)((r - rounds) * 1000000000ULL / (now - start)),
+               (unsigned long long)((s - sleeps) * 1000000000ULL / (now - start)),
+               (unsigned)inst_lost);
+        rounds = r;
+        sleeps = s;
+        start  = now;
+    }
+    return nullptr;
+}
+
+// 环境变量 BENCH_INSTANCES=2 时使用两个实例，控制器总数(COROUTINE_THREADS)平分
+static void Bench_Instance_Start(void)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    extern const Coroutine_Inter *NewInter(size_t thread_count);
+    extern void                   RunTask(void *(*func)(void *arg), void *arg);
+    const char *                  env     = getenv("BENCH_INSTANCES");
+    int                           num     = env != nullptr && atoi(env) == 2 ? 2 : 1;
+    size_t                        threads = GetInter()->thread_count;
+    Coroutine_Instance            inst[2];
+    if (threads < (size_t)num) threads = num;
+    for (int i = 0; i < num; i++) {
+        size_t n = threads / num + ((size_t)i < threads % num);
+        inst[i]  = Coroutine.CreateInstance(NewInter(n));
+        for (size_t k = 0; k < n; k++)
+            RunTask(Bench_Instance_Run, inst[i]);
+    }
+    for (int s = 0; s < INSTANCE_SHARDS; s++) {
+        Coroutine_Instance prev = Coroutine.SelectInstance(inst[s % num]);
+        for (int p = 0; p < INSTANCE_PAIRS; p++) {
+            intptr_t idx    = s * INSTANCE_PAIRS + p;
+            inst_ping[s][p] = Coroutine.CreateSemaphore("bench-inst-ping", 0);
+            inst_pong[s][p] = Coroutine.CreateSemaphore("bench-inst-pong", 0);
+            Coroutine.AddTask(Bench_Instance_Ping, (void *)idx, TASK_PRI_NORMAL, 0, "Inst-Ping", nullptr);
+            Coroutine.AddTask(Bench_Instance_Pong, (void *)idx, TASK_PRI_NORMAL, 0, "Inst-Pong", nullptr);
+        }
+        for (int i = 0; i < INSTANCE_SLEEPERS; i++)
+            Coroutine.AddTask(Bench_Instance_Sleep, (void *)(intptr_t)s, TASK_PRI_NORMAL, 0, "Inst-Sleep", nullptr);
+        Coroutine.SelectInstance(prev);
+    }
+    RunTask(Bench_Instance_Report, (void *)(intptr_t)num);
+    return;
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       NUMA 分组        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_NUMA
+#define NUMA_TASKS   16   // 每个节点初始任务数(都创建在该节点的第一个控制器上)
+#define NUMA_WORK_US 20   // 每次运行占用时间 us
+#define NUMA_SLEEP_EVERY 8   // 每运行多少次休眠 1 ms
+
+static int               numa_nodes;          // 模拟节点数(COROUTINE_NUMA_FAKE)
+static volatile uint64_t numa_runs;
+static volatile uint64_t numa_local;          // 迁移到本节点其他控制器的次数
+static volatile uint64_t numa_remote;         // 迁移到其他节点的次数
+static volatile uint64_t numa_err_place;      // 控制器节点与 GetNode 不一致
+static volatile uint64_t numa_err_thread;     // 控制器线程未绑定到所在节点的 CPU
+static volatile uint64_t numa_err_stack;      // 任务栈未绑定到创建时控制器所在节点
+
+static uint16_t Bench_Numa_Controllers(void)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    return (uint16_t)GetInter()->thread_count;
+}
+
+static uint16_t Bench_Numa_Node(uint16_t co_id)
+{
+    Coroutine_ControllerInfo info;
+    return Coroutine.GetControllerInfo(co_id, &info) ? info.node : 0xFFFF;
+}
+
+// 与 port.cpp 模拟拓扑相同：CPU 按节点平分，节点多于 CPU 时共用
+static void Bench_Numa_Check_Thread(uint16_t co_id)
+{
+    long      cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint16_t  node = Bench_Numa_Node(co_id);
+    cpu_set_t set, expect;
+    CPU_ZERO(&expect);
+    if (cpus <= 0) cpus = 1;
+    for (long cpu = (long)node * cpus / numa_nodes; cpu < (long)(node + 1) * cpus / numa_nodes; cpu++)
+        CPU_SET(cpu, &expect);
+    if (CPU_COUNT(&expect) == 0)
+        CPU_SET(node % cpus, &expect);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        __atomic_fetch_add(&numa_err_thread, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    CPU_AND(&expect, &expect, &set);   // COROUTINE_PIN_CPU 时只绑定其中一个 CPU
+    if (CPU_COUNT(&set) == 0 || !CPU_EQUAL(&expect, &set))
+        __atomic_fetch_add(&numa_err_thread, 1, __ATOMIC_RELAXED);
+}
+
+static void Bench_Numa_Worker(void *obj)
+{
+    extern bool PortNumaFakeNode(const void *addr, uint16_t *node);
+    uint16_t    home = (uint16_t)(intptr_t)obj;
+    uint16_t    last = Coroutine.GetCurrentCoroutineIdx();
+    uint16_t    node = 0xFFFF;
+    // 栈(局部变量所在)按创建时的控制器绑定，第一次运行前可能已被窃取
+    if (!PortNumaFakeNode(&home, &node) || node != Bench_Numa_Node(home))
+        __atomic_fetch_add(&numa_err_stack, 1, __ATOMIC_RELAXED);
+    Bench_Numa_Check_Thread(last);
+    for (uint32_t n = 1;; n++) {
+        uint64_t end = GetNanosecond() + NUMA_WORK_US * 1000ULL;
+        while (GetNanosecond() < end)
+            ;
+        if (n % NUMA_SLEEP_EVERY == 0)
+            Coroutine.YieldDelay(1);   // 短暂休眠，控制器时常为空而窃取
+        else
+            Coroutine.Yield();
+        uint16_t co_id = Coroutine.GetCurrentCoroutineIdx();
+        if (co_id != last) {
+            if (Bench_Numa_Node(co_id) == Bench_Numa_Node(last))
+                __atomic_fetch_add(&numa_local, 1, __ATOMIC_RELAXED);
+            else
+                __atomic_fetch_add(&numa_remote, 1, __ATOMIC_RELAXED);
+            Bench_Numa_Check_Thread(co_id);
+            last = co_id;
+        }
+        __atomic_fetch_add(&numa_runs, 1, __ATOMIC_RELAXED);
+    }
+}
+
+// 固定到控制器 co_id 后在本控制器创建任务，该节点的其他控制器空闲时应从本节点窃取
+static void Bench_Numa_Spawn(void *obj)
+{
+    uint16_t co_id = (uint16_t)(intptr_t)obj;
+    Coroutine.SetTaskAffinity(nullptr, (Coroutine_Affinity)1 << co_id, true);
+    Coroutine.Yield();
+    for (int i = 0; i < NUMA_TASKS; i++)
+        Coroutine.AddTaskPlacement(Bench_Numa_Worker, (void *)(intptr_t)co_id, TASK_PRI_NORMAL, 0, "Numa-Worker", CO_PLACE_LOCAL, nullptr);
+}
+
+static void Bench_Numa_Report(void *obj)
+{
+    uint64_t start = GetNanosecond(), runs = 0;
+    while (true) {
+        Coroutine.YieldDelay(1000);
+        uint64_t tv = GetNanosecond() - start;
+        start       = GetNanosecond();
+        // 本节点有可窃取的任务时不应跨节点窃取(跨节点只在本节点都为空时发生)
+        bool isPass = numa_err_place + numa_err_thread + numa_err_stack == 0 && numa_local > 0 && numa_remote * 10 <= numa_local;
+        printf("[bench numa] nodes %d controllers %u runs %llu/s moves local %llu remote %llu errors place %llu thread %llu stack %llu %s\n",
+               numa_nodes,
+               (unsigned)Bench_Numa_Controllers(),
+               (unsigned long long)((numa_runs - runs) * 1000000000ULL / tv),
+               (unsigned long long)numa_local,
+               (unsigned long long)numa_remote,
+               (unsigned long long)numa_err_place,
+               (unsigned long long)numa_err_thread,
+               (unsigned long long)numa_err_stack,
+               isPass ? "PASS" : "FAIL");
+        runs = numa_runs;
+    }
+}
+
+static void Bench_Numa_Start(void)
+{
+    const char *fake = getenv("COROUTINE_NUMA_FAKE");
+    numa_nodes       = fake == nullptr ? 0 : atoi(fake);
+    if (numa_nodes < 2 || Bench_Numa_Controllers() < (uint16_t)numa_nodes * 2 || numa_nodes > 32) {
+        printf("[bench numa] requires COROUTINE_NUMA_FAKE=n (2~32) and COROUTINE_THREADS >= 2n\n");
+        return;
+    }
+    // 控制器按 port.cpp GetNode 轮流分配到各节点
+    for (uint16_t i = 0; i < Bench_Numa_Controllers(); i++) {
+        if (Bench_Numa_Node(i) != i % numa_nodes)
+            numa_err_place++;
+    }
+    for (int i = 0; i < numa_nodes; i++)
+        Coroutine.AddTask(Bench_Numa_Spawn, (void *)(intptr_t)i, TASK_PRI_NORMAL, 0, "Numa-Spawn", nullptr);
+    Coroutine.AddTask(Bench_Numa_Report, nullptr, TASK_PRI_HIGHEST, 0, "Numa-Report", nullptr);
+    return;
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       互斥锁竞争        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_MUTEX
+#define MUTEX_TASKS 16   // 争用任务数
+
+static const uint32_t    mutex_cs_ns[] = {0, 100, 300, 1000, 3000, 10000};   // 临界区长度 ns
+static Coroutine_Mutex   mutex_lock;
+static volatile uint32_t mutex_cs;      // 当前临界区长度 ns
+static volatile uint64_t mutex_count;   // 加锁次数(锁内累加)
+
+static void Bench_Mutex_Task(void *obj)
+{
+    while (true) {
+        Coroutine.LockMutex(mutex_lock, UINT32_MAX);
+        uint64_t end = GetNanosecond() + mutex_cs;
+        while (mutex_cs && GetNanosecond() < end) {
+        }
+        mutex_count++;
+        Coroutine.UnlockMutex(mutex_lock);
+        Coroutine.Yield();
+    }
+}
+
+static void Bench_Mutex_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    while (true) {
+        for (size_t i = 0; i < sizeof(mutex_cs_ns) / sizeof(mutex_cs_ns[0]); i++) {
+            mutex_cs       = mutex_cs_ns[i];
+            uint64_t last  = mutex_count;
+            uint64_t start = GetNanosecond();
+            Coroutine.YieldDelay(1000);
+            uint64_t tv = GetNanosecond() - start;
+            printf("[bench mutex] spin %d controllers %u tasks %d cs %5u ns locks %llu/s\n",
+                   COROUTINE_MUTEX_SPIN,
+                   (unsigned)GetInter()->thread_count,
+                   MUTEX_TASKS,
+                   mutex_cs_ns[i],
+                   (unsigned long long)((mutex_count - last) * 1000000000ULL / tv));
+        }
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       优先级反转        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_INHERIT
+#define INHERIT_MEDIUMS 4       // 中优先级任务数
+#define INHERIT_BUSY_MS 20      // 中优先级任务每轮占用时间 ms
+#define INHERIT_WORK    100     // 低优先级任务持锁期间 Yield 次数
+
+static Coroutine_Mutex     inherit_lock;
+static Coroutine_Semaphore inherit_start, inherit_done;
+static volatile uint64_t   inherit_rounds;
+static volatile uint64_t   inherit_wait_max;   // ns
+static volatile uint64_t   inherit_wait_sum;   // ns
+static volatile uint64_t   inherit_stray;      // 不在控制器 0 上运行的次数(固定失效时结果无效)
+
+// 全部任务固定在控制器 0，其他控制器空闲时也不能窃取
+static void Bench_Inherit_Check(void)
+{
+    if (Coroutine.GetCurrentCoroutineIdx() != 0)
+        __atomic_fetch_add(&inherit_stray, 1, __ATOMIC_RELAXED);
+}
+
+// 低优先级：持锁后放行其他任务，锁内工作期间只有被继承提升才能运行
+static void Bench_Inherit_Low(void *obj)
+{
+    Coroutine.SetTaskAffinity(nullptr, 1, true);
+    while (true) {
+        Coroutine.LockMutex(inherit_lock, UINT32_MAX);
+        Coroutine.GiveSemaphore(inherit_start, 1 + INHERIT_MEDIUMS);
+        for (int i = 0; i < INHERIT_WORK; i++) {
+            Coroutine.Yield();
+            Bench_Inherit_Check();
+        }
+        Coroutine.UnlockMutex(inherit_lock);
+        Coroutine.WaitSemaphore(inherit_done, 1 + INHERIT_MEDIUMS, UINT32_MAX);
+    }
+}
+
+// 中优先级：不使用锁，每轮占满控制器一段时间
+static void Bench_Inherit_Medium(void *obj)
+{
+    Coroutine.SetTaskAffinity(nullptr, 1, true);
+    while (true) {
+        Coroutine.WaitSemaphore(inherit_start, 1, UINT32_MAX);
+        uint64_t end = GetNanosecond() + INHERIT_BUSY_MS * 1000000ULL;
+        while (GetNanosecond() < end) {
+            Coroutine.Yield();
+            Bench_Inherit_Check();
+        }
+        Coroutine.GiveSemaphore(inherit_done, 1);
+    }
+}
+
+// 高优先级：统计从放行到获取锁的时间
+static void Bench_Inherit_High(void *obj)
+{
+    Coroutine.SetTaskAffinity(nullptr, 1, true);
+    while (true) {
+        Coroutine.WaitSemaphore(inherit_start, 1, UINT32_MAX);
+        uint64_t start = GetNanosecond();
+        Coroutine.LockMutex(inherit_lock, UINT32_MAX);
+        uint64_t tv = GetNanosecond() - start;
+        Bench_Inherit_Check();
+        Coroutine.UnlockMutex(inherit_lock);
+        if (tv > inherit_wait_max) inherit_wait_max = tv;
+        inherit_wait_sum += tv;
+        inherit_rounds++;
+        Coroutine.GiveSemaphore(inherit_done, 1);
+    }
+}
+
+static void Bench_Inherit_Report(void *obj)
+{
+    while (true) {
+        Coroutine.YieldDelay(1000);
+        uint64_t rounds = inherit_rounds;
+        printf("[bench inherit] inherit %d rounds %llu high wait avg %llu us max %llu us (medium busy %d ms) stray %llu\n",
+               COROUTINE_MUTEX_INHERIT,
+               (unsigned long long)rounds,
+               (unsigned long long)(rounds ? inherit_wait_sum / rounds / 1000 : 0),
+               (unsigned long long)(inherit_wait_max / 1000),
+               INHERIT_BUSY_MS,
+               (unsigned long long)inherit_stray);
+        inherit_rounds   = 0;
+        inherit_wait_sum = 0;
+        inherit_wait_max = 0;
+        inherit_stray    = 0;
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       读写锁        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_RWLOCK
+#define RWLOCK_READERS  64   // 读者任务数
+#define RWLOCK_TABLE    16   // 共享表大小
+#define RWLOCK_WRITE_MS 10   // 写入间隔 ms
+
+typedef struct
+{
+    volatile uint64_t count;
+    uint8_t           pad[64 - sizeof(uint64_t)];
+} RWLockCounter;
+
+static CO::RWLock        *rwlock_lock;
+static CO::Mutex         *rwlock_mutex;   // BENCH_RWLOCK_MUTEX=1 时使用
+static volatile uint32_t  rwlock_table[RWLOCK_TABLE];
+static RWLockCounter      rwlock_reads[RWLOCK_READERS];
+static volatile uint64_t  rwlock_writes;
+
+static void Bench_RWLock_Reader(void *obj)
+{
+    RWLockCounter *cnt = &rwlock_reads[(intptr_t)obj];
+    while (true) {
+        uint32_t sum = 0;
+        if (rwlock_mutex) {
+            rwlock_mutex->Lock();
+            for (int i = 0; i < RWLOCK_TABLE; i++)
+                sum += rwlock_table[i];
+            rwlock_mutex->UnLock();
+        } else {
+            CO::RWLock::ReadGuard guard(*rwlock_lock);
+            for (int i = 0; i < RWLOCK_TABLE; i++)
+                sum += rwlock_table[i];
+        }
+        if (sum % RWLOCK_TABLE)
+            printf("[bench rwlock] torn read %u\n", sum);
+        cnt->count++;
+        Coroutine.Yield();
+    }
+}
+
+// 写者整体修改共享表，读者看到的总和始终是 RWLOCK_TABLE 的倍数
+static void Bench_RWLock_Writer(void *obj)
+{
+    while (true) {
+        Coroutine.YieldDelay(RWLOCK_WRITE_MS);
+        if (rwlock_mutex) rwlock_mutex->Lock();
+        else rwlock_lock->WriteLock();
+        for (int i = 0; i < RWLOCK_TABLE; i++)
+            rwlock_table[i]++;
+        rwlock_writes++;
+        if (rwlock_mutex) rwlock_mutex->UnLock();
+        else rwlock_lock->UnLock();
+    }
+}
+
+// 检查：在检查任务持有读锁时等待写锁
+static volatile int rwlock_check_writer;   // 0：未获取 1：获取 2：超时
+
+static void Bench_RWLock_CheckWriter(void *obj)
+{
+    bool isOk           = Coroutine.WriteLock((Coroutine_RWLock)obj, 1000);
+    rwlock_check_writer = isOk ? 1 : 2;
+    if (isOk) Coroutine.UnlockRWLock((Coroutine_RWLock)obj);
+}
+
+static void Bench_RWLock_Check(void *obj)
+{
+    Coroutine_RWLock a = Coroutine.CreateRWLock("bench-check-a", true);
+    Coroutine_RWLock b = Coroutine.CreateRWLock("bench-check-b", true);
+    if ((intptr_t)obj == 2) {
+        // 持有 a 的读锁时释放 b：应报告 CO_ERR_RWLOCK_RELIEVE(错误回调不返回)
+        Coroutine.ReadLock(a, 0);
+        printf("[bench rwlock] unlock wrong lock, expect Coroutine Error: %d\n", CO_ERR_RWLOCK_RELIEVE);
+        Coroutine.UnlockRWLock(b);
+        printf("[bench rwlock] unlock wrong lock FAIL: not reported\n");
+        return;
+    }
+    // 写优先：写者已在等待读者退出时，持有读锁的任务再次获取同一把锁的读锁
+    Coroutine.ReadLock(a, 0);
+    Coroutine.AddTask(Bench_RWLock_CheckWriter, a, TASK_PRI_NORMAL, 0, "RWLock-CheckWriter", nullptr);
+    Coroutine.YieldDelay(10);
+    uint64_t start     = GetNanosecond();
+    bool     isRead    = Coroutine.ReadLock(a, 100);
+    uint64_t tv        = GetNanosecond() - start;
+    bool     isUpgrade = Coroutine.WriteLock(a, 100);   // 持有读锁时不能升级
+    if (isRead) Coroutine.UnlockRWLock(a);
+    Coroutine.UnlockRWLock(a);
+    Coroutine.YieldDelay(10);
+    bool isOk = isRead && tv < 1000000 && !isUpgrade && rwlock_check_writer == 1;
+    printf("[bench rwlock] recursive read %s (%llu us) upgrade %s writer %s: %s\n",
+           isRead ? "ok" : "timeout",
+           (unsigned long long)(tv / 1000),
+           isUpgrade ? "granted" : "refused",
+           rwlock_check_writer == 1 ? "ok" : "blocked",
+           isOk ? "PASS" : "FAIL");
+}
+
+static void Bench_RWLock_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    uint64_t                      last = 0, writes = 0;
+    while (true) {
+        uint64_t start = GetNanosecond();
+        Coroutine.YieldDelay(1000);
+        uint64_t total = 0;
+        for (int i = 0; i < RWLOCK_READERS; i++)
+            total += rwlock_reads[i].count;
+        uint64_t tv = GetNanosecond() - start;
+        printf("[bench rwlock] %s controllers %u readers %d reads %llu/s writes %llu\n",
+               rwlock_mutex ? "mutex " : "rwlock",
+               (unsigned)GetInter()->thread_count,
+               RWLOCK_READERS,
+               (unsigned long long)((total - last) * 1000000000ULL / tv),
+               (unsigned long long)(rwlock_writes - writes));
+        last   = total;
+        writes = rwlock_writes;
+    }
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       事件组        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_EVENT
+#define EVENT_PAIRS    16                  // 往返任务对数(每对占用 2 位)
+#define EVENT_IDLE_BIT ((uint64_t)1 << 63)   // 无关等待者等待的位(不置位)
+
+static Coroutine_EventGroup event_group;
+static volatile uint64_t    event_count[EVENT_PAIRS];
+static int                  event_idle;
+
+static void Bench_Event_Ping(void *obj)
+{
+    int      i    = (int)(intptr_t)obj;
+    uint64_t ping = (uint64_t)1 << (i * 2);
+    uint64_t pong = ping << 1;
+    while (true) {
+        Coroutine.SetEventBits(event_group, ping);
+        Coroutine.WaitEventBits(event_group, pong, false, true, UINT32_MAX);
+        event_count[i]++;
+    }
+}
+
+static void Bench_Event_Pong(void *obj)
+{
+    int      i    = (int)(intptr_t)obj;
+    uint64_t ping = (uint64_t)1 << (i * 2);
+    uint64_t pong = ping << 1;
+    while (true) {
+        Coroutine.WaitEventBits(event_group, ping, false, true, UINT32_MAX);
+        Coroutine.SetEventBits(event_group, pong);
+    }
+}
+
+static void Bench_Event_Idle(void *obj)
+{
+    while (true)
+        Coroutine.WaitEventBits(event_group, EVENT_IDLE_BIT, true, false, UINT32_MAX);
+}
+
+static void Bench_Event_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    uint64_t                      last = 0;
+    while (true) {
+        uint64_t start = GetNanosecond();
+        Coroutine.YieldDelay(1000);
+        uint64_t total = 0;
+        for (int i = 0; i < EVENT_PAIRS; i++)
+            total += event_count[i];
+        uint64_t tv = GetNanosecond() - start;
+        printf("[bench event] controllers %u pairs %d idle waiters %d round trips %llu/s\n",
+               (unsigned)GetInter()->thread_count,
+               EVENT_PAIRS,
+               event_idle,
+               (unsigned long long)((total - last) * 1000000000ULL / tv));
+        last = total;
+    }
+}
+#endif
+
+
+// --------------------------------------------------------------------------------------
+//                              |       事件组消费        |
+// --------------------------------------------------------------------------------------
+
+#if BENCH_EVENT_CONSUME
+#define CONSUME_BITS    8   // 使用的位数
+#define CONSUME_SETTERS 4   // 置位任务数
+#define CONSUME_WAITERS 8   // 挂起等待任务数(一半等待任意位，一半等待全部位)
+#define CONSUME_POLLERS 4   // 不等待的任务数(只走快速路径)
+
+static Coroutine_EventGroup consume_group;
+static volatile uint64_t    consume_sets;          // 置位次数
+static volatile uint64_t    consume_transitions;   // 0→1 置位的位数
+static volatile uint64_t    consume_consumed;      // 等待者清除的位数
+static volatile uint32_t    consume_active;        // 正在置位的任务数
+static volatile uint32_t    consume_pause;         // 报告时暂停置位
+
+static uint32_t Bench_Consume_Rand(uint32_t *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 16;
+}
+
+// 随机选 1~2 位
+static uint64_t Bench_Consume_Mask(uint32_t *seed)
+{
+    uint64_t mask = (uint64_t)1 << (Bench_Consume_Rand(seed) % CONSUME_BITS);
+    if (Bench_Consume_Rand(seed) & 1)
+        mask |= (uint64_t)1 << (Bench_Consume_Rand(seed) % CONSUME_BITS);
+    return mask;
+}
+
+static void Bench_Consume_Setter(void *obj)
+{
+    uint32_t seed = (uint32_t)(intptr_t)obj;
+    while (true) {
+        __atomic_fetch_add(&consume_active, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&consume_pause, __ATOMIC_SEQ_CST)) {
+            __atomic_fetch_sub(&consume_active, 1, __ATOMIC_SEQ_CST);
+            Coroutine.YieldDelay(1);
+            continue;
+        }
+        uint64_t bits = Bench_Consume_Mask(&seed);
+        uint64_t old  = Coroutine.SetEventBits(consume_group, bits);
+        __atomic_fetch_add(&consume_transitions, __builtin_popcountll(bits & ~old), __ATOMIC_RELAXED);
+        __atomic_fetch_add(&consume_sets, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_sub(&consume_active, 1, __ATOMIC_SEQ_CST);
+        Coroutine.Yield();
+    }
+}
+
+static void Bench_Consume_Waiter(void *obj)
+{
+    uint32_t seed  = (uint32_t)(intptr_t)obj;
+    bool     isAll = (intptr_t)obj & 1;
+    while (true) {
+        uint64_t ret = Coroutine.WaitEventBits(consume_group, Bench_Consume_Mask(&seed), isAll, true, 10);
+        __atomic_fetch_add(&consume_consumed, __builtin_popcountll(ret), __ATOMIC_RELAXED);
+    }
+}
+
+static void Bench_Consume_Poller(void *obj)
+{
+    uint32_t seed = (uint32_t)(intptr_t)obj;
+    while (true) {
+        uint64_t ret = Coroutine.WaitEventBits(consume_group, Bench_Consume_Mask(&seed), false, true, 0);
+        __atomic_fetch_add(&consume_consumed, __builtin_popcountll(ret), __ATOMIC_RELAXED);
+        Coroutine.Yield();
+    }
+}
+
+// 暂停置位后 已消费 + 仍置位的位数 应等于 0→1 置位的位数
+static void Bench_Consume_Report(void *obj)
+{
+    extern const Coroutine_Inter *GetInter(void);
+    uint64_t                      sets = 0;
+    while (true) {
+        uint64_t start = GetNanosecond();
+        Coroutine.YieldDelay(1000);
+        __atomic_store_n(&consume_pause, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&consume_active, __ATOMIC_SEQ_CST))
+            Coroutine.Yield();
+        Coroutine.YieldDelay(50);   // 等待已唤醒的等待者计数
+        uint64_t tv        = GetNanosecond() - start;
+        uint64_t remain    = __builtin_popcountll(Coroutine.GetEventBits(consume_group));
+        uint64_t consumed  = consume_consumed + remain;
+        uint64_t transitions = consume_transitions;
+        printf("[bench event consume] controllers %u sets %llu/s transitions %llu consumed %llu over %llu lost %llu\n",
+               (unsigned)GetInter()->thread_count,
+               (unsigned long long)((consume_sets - sets) * 1000000000ULL / tv),
+               (unsigned long long)transitions,
+               (unsigned long long)consume_consumed,
+               (unsigned long long)(consumed > transitions ? consumed - transitions : 0),
+               (unsigned long long)(consumed < transitions ? transitions - consumed : 0));
+        sets = consume_sets;
+        __atomic_store_n(&consume_pause, 0, __ATOMIC_SEQ_CST);
+    }
+}
+#endif
+
+/**
+ * @brief    启动基准测试
+ * @return   true           已启动测试任务，不再运行演示任务
+ * @date     2026-10-17
+ */
+bool Bench_Start(void)
+{
+    bool isBench = false;
+#if BENCH_SWITCH
+    for (int i = 0; i < SWITCH_PAIRS; i++) {
+        Coroutine_Channel ch = Coroutine.CreateChannel("bench-switch", 0);
+        Coroutine.AddTask(Bench_Switch_1, ch, TASK_PRI_NORMAL, 0, "Switch-1", nullptr);
+        Coroutine.AddTask(Bench_Switch_2, ch, TASK_PRI_NORMAL, 0, "Switch-2", nullptr);
+    }
+    isBench = true;
+#endif
+#if BENCH_SCALE
+    for (int i = 0; i < SCALE_TASKS; i++)
+        Coroutine.AddTask(Bench_Scale_Task, (void *)&scale_count[i], TASK_PRI_NORMAL, 0, "Scale", nullptr);
+    Coroutine.AddTask(Bench_Scale_Report, nullptr, TASK_PRI_HIGHEST, 0, "Scale-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_STARVE
+    starve_start = Coroutine.CreateSemaphore("bench-starve-start", 0);
+    for (int i = 0; i < STARVE_BUSY; i++)
+        Coroutine.AddTask(Bench_Starve_Busy, nullptr, TASK_PRI_NORMAL, 0, "Starve-Busy", nullptr);
+    for (int i = 0; i < STARVE_SLEEPERS; i++)
+        Coroutine.AddTask(Bench_Starve_Sleeper, nullptr, TASK_PRI_NORMAL, 0, "Starve-Sleeper", nullptr);
+    Coroutine.AddTask(Bench_Starve_Report, nullptr, TASK_PRI_HIGHEST, 0, "Starve-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_AFFINITY
+    affinity_sem = Coroutine.CreateSemaphore("bench-affinity", 0);
+    affinity_ack = Coroutine.CreateSemaphore("bench-affinity-ack", 0);
+    for (int i = 0; i < AFFINITY_TASKS; i++) {
+        Coroutine.AddTask(Bench_Affinity_Busy, nullptr, TASK_PRI_NORMAL, 0, "Affinity-Busy", nullptr);
+        Coroutine.AddTask(Bench_Affinity_Waiter, nullptr, TASK_PRI_NORMAL, 0, "Affinity-Waiter", nullptr);
+        Coroutine.AddTask(Bench_Affinity_Giver, nullptr, TASK_PRI_NORMAL, 0, "Affinity-Giver", nullptr);
+        Coroutine.AddTask(Bench_Affinity_Flip, nullptr, TASK_PRI_NORMAL, 0, "Affinity-Flip", nullptr);
+    }
+    Coroutine.AddTask(Bench_Affinity_Report, nullptr, TASK_PRI_HIGHEST, 0, "Affinity-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_SPAWN
+    Coroutine.AddTask(Bench_Spawn, nullptr, TASK_PRI_NORMAL, 0, "Spawn", nullptr);
+    isBench = true;
+#endif
+#if BENCH_TIMER
+    for (int i = 0; i < TIMER_TASKS; i++) {
+        timer_sem[i] = Coroutine.CreateSemaphore("bench-timer", 0);
+        Coroutine.AddTask(Bench_Timer_Wait, (void *)(intptr_t)i, TASK_PRI_NORMAL, 0, "Timer-Wait", nullptr);
+    }
+    Coroutine.AddTask(Bench_Timer_Give, nullptr, TASK_PRI_NORMAL, 0, "Timer-Give", nullptr);
+    Coroutine.AddTask(Bench_Timer_Report, nullptr, TASK_PRI_HIGHEST, 0, "Timer-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_SKEW
+    skew_start = Coroutine.CreateSemaphore("bench-skew-start", 0);
+    skew_done  = Coroutine.CreateSemaphore("bench-skew-done", 0);
+    for (int i = 0; i < SKEW_TASKS; i++)
+        Coroutine.AddTask(Bench_Skew_Task, (void *)(intptr_t)i, TASK_PRI_NORMAL, 0, "Skew", nullptr);
+    Coroutine.AddTask(Bench_Skew_Report, nullptr, TASK_PRI_HIGHEST, 0, "Skew-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_WAKE
+    extern void RunTask(void *(*func)(void *arg), void *arg);
+    wake_sem = Coroutine.CreateSemaphore("bench-wake", 0);
+    Coroutine.AddTask(Bench_Wake_Wait, nullptr, TASK_PRI_NORMAL, 0, "Wake-Wait", nullptr);
+    RunTask(Bench_Wake_Give, nullptr);
+    isBench = true;
+#endif
+#if BENCH_CURRENT
+    Coroutine.AddTask(Bench_Current, nullptr, TASK_PRI_NORMAL, 0, "Current", nullptr);
+    isBench = true;
+#endif
+#if BENCH_PLACE
+    Coroutine.AddTask(Bench_Place, nullptr, TASK_PRI_NORMAL, 0, "Place", nullptr);
+    isBench = true;
+#endif
+#if BENCH_INBOX
+    for (int i = 0; i < INBOX_PRODUCERS; i++) {
+        inbox_ack[i] = Coroutine.CreateSemaphore("bench-inbox-ack", 0);
+        for (int k = 0; k < INBOX_DEPTH; k++) {
+            inbox_req[i][k] = Coroutine.CreateSemaphore("bench-inbox-req", 0);
+            Coroutine.AddTask(Bench_Inbox_Consumer, (void *)(intptr_t)(i * INBOX_DEPTH + k), TASK_PRI_NORMAL, 0, "Inbox-Consumer", nullptr);
+        }
+        Coroutine.AddTask(Bench_Inbox_Producer, (void *)(intptr_t)i, TASK_PRI_NORMAL, 0, "Inbox-Producer", nullptr);
+    }
+    Coroutine.AddTask(Bench_Inbox_Report, nullptr, TASK_PRI_HIGHEST, 0, "Inbox-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_INSTANCE
+    Bench_Instance_Start();
+    isBench = true;
+#endif
+#if BENCH_NUMA
+    Bench_Numa_Start();
+    isBench = true;
+#endif
+#if BENCH_MUTEX
+    mutex_lock = Coroutine.CreateMutex("bench-mutex");
+    for (int i = 0; i < MUTEX_TASKS; i++)
+        Coroutine.AddTask(Bench_Mutex_Task, nullptr, TASK_PRI_NORMAL, 0, "Mutex", nullptr);
+    Coroutine.AddTask(Bench_Mutex_Report, nullptr, TASK_PRI_HIGHEST, 0, "Mutex-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_INHERIT
+    inherit_lock  = Coroutine.CreateMutex("bench-inherit");
+    inherit_start = Coroutine.CreateSemaphore("bench-inherit-start", 0);
+    inherit_done  = Coroutine.CreateSemaphore("bench-inherit-done", 0);
+    Coroutine.AddTask(Bench_Inherit_High, nullptr, TASK_PRI_HIGHEST, 0, "Inherit-High", nullptr);
+    for (int i = 0; i < INHERIT_MEDIUMS; i++)
+        Coroutine.AddTask(Bench_Inherit_Medium, nullptr, TASK_PRI_NORMAL, 0, "Inherit-Medium", nullptr);
+    Coroutine.AddTask(Bench_Inherit_Low, nullptr, TASK_PRI_LOWEST, 0, "Inherit-Low", nullptr);
+    Coroutine.AddTask(Bench_Inherit_Report, nullptr, TASK_PRI_HIGHEST, 0, "Inherit-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_RWLOCK
+    const char *check = getenv("BENCH_RWLOCK_CHECK");
+    if (check != nullptr && atoi(check) != 0) {
+        Coroutine.AddTask(Bench_RWLock_Check, (void *)(intptr_t)atoi(check), TASK_PRI_NORMAL, 0, "RWLock-Check", nullptr);
+        return true;
+    }
+    const char *env = getenv("BENCH_RWLOCK_MUTEX");
+    if (env != nullptr && atoi(env) == 1)
+        rwlock_mutex = new CO::Mutex("bench-rwlock-mutex");
+    else
+        rwlock_lock = new CO::RWLock("bench-rwlock");
+    for (int i = 0; i < RWLOCK_READERS; i++)
+        Coroutine.AddTask(Bench_RWLock_Reader, (void *)(intptr_t)i, TASK_PRI_NORMAL, 0, "RWLock-Reader", nullptr);
+    Coroutine.AddTask(Bench_RWLock_Writer, nullptr, TASK_PRI_NORMAL, 0, "RWLock-Writer", nullptr);
+    Coroutine.AddTask(Bench_RWLock_Report, nullptr, TASK_PRI_HIGHEST, 0, "RWLock-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_EVENT
+    const char *idle = getenv("BENCH_EVENT_IDLE");
+    event_idle       = idle == nullptr ? 0 : atoi(idle);
+    event_group      = Coroutine.CreateEventGroup("bench-event");
+    for (int i = 0; i < event_idle; i++)
+        Coroutine.AddTask(Bench_Event_Idle, nullptr, TASK_PRI_NORMAL, 0, "Event-Idle", nullptr);
+    for (int i = 0; i < EVENT_PAIRS; i++) {
+        Coroutine.AddTask(Bench_Event_Ping, (void *)(intptr_t)i, TASK_PRI_NORMAL, 0, "Event-Ping", nullptr);
+        Coroutine.AddTask(Bench_Event_Pong, (void *)(intptr_t)i, TASK_PRI_NORMAL, 0, "Event-Pong", nullptr);
+    }
+    Coroutine.AddTask(Bench_Event_Report, nullptr, TASK_PRI_HIGHEST, 0, "Event-Report", nullptr);
+    isBench = true;
+#endif
+#if BENCH_EVENT_CONSUME
+    consume_group = Coroutine.CreateEventGroup("bench-consume");
+    for (int i = 0; i < CONSUME_SETTERS; i++)
+        Coroutine.AddTask(Bench_Consume_Setter, (void *)(intptr_t)(i + 1), TASK_PRI_NORMAL, 0, "Consume-Setter", nullptr);
+    for (int i = 0; i < CONSUME_WAITERS; i++)
+        Coroutine.AddTask(Bench_Consume_Waiter, (void *)(intptr_t)(i + 100), TASK_PRI_NORMAL, 0, "Consume-Waiter", nullptr);
+    for (int i = 0; i < CONSUME_POLLERS; i++)
+        Coroutine.AddTask(Bench_Consume_Poller, (void *)(intptr_t)(i + 200), TASK_PRI_NORMAL, 0, "Consume-Poller", nullptr);
+    Coroutine.AddTask(Bench_Consume_Report, nullptr, TASK_PRI_HIGHEST, 0, "Consume-Report", nullptr);
+    isBench = true;
+#endif
+    return isBench;
+}
@@ -6,6 +6,27 @@
 #include "nplog.h"
 #include <unistd.h>
 #include <functional>
+#include <sys/resource.h>
+
+// 主线程调用毫秒中断(控制器空闲时按到期时间自行唤醒，可不调用)
+#ifndef DEMO_MS_INTERRUPT
+#define DEMO_MS_INTERRUPT 0
+#endif
+
+// 空闲演示：只运行唤醒延迟任务，观察空闲 CPU 占用
+#ifndef DEMO_IDLE
+#define DEMO_IDLE 0
+#endif
+
+// 切换演示：只运行 Task7(Yield 计数)，PrintCount 的 count1 即每秒切换次数
+#ifndef DEMO_YIELD
+#define DEMO_YIELD 0
+#endif
+
+// 控制器线程每次调用 RunTicks 运行的最多任务数，0：每次调用 RunTick 运行一个任务
+#ifndef DEMO_RUN_TICKS
+#define DEMO_RUN_TICKS 0
+#endif
 
 NPLOG_DEFINE(main, NPLOG_LEVEL_DEBUG);
 #undef LOG_PRINTF_Array
@@ -22,6 +43,7 @@ NPLOG_DEFINE(main, NPLOG_LEVEL_DEBUG);
 
 extern void Sleep(uint32_t time);
 extern void RunTask(void *(*func)(void *arg), void *arg);
+extern void StartControllers(void *(*func)(void *arg));
 extern void PrintMemory(void);
 
 Coroutine_Semaphore sem1;
@@ -158,8 +180,15 @@ void Task5(void *obj)
 
 static void *RUNTask(void *obj)
 {
-    while (true)
+    extern void PinThread(void);
+    PinThread();
+    while (true) {
+#if DEMO_RUN_TICKS
+        Coroutine.RunTicks(UINT32_MAX, DEMO_RUN_TICKS, 0);
+#else
         Coroutine.RunTick(UINT32_MAX);
+#endif
+    }
     return nullptr;
 }
 
@@ -206,6 +235,46 @@ void PrintCount(void)
     printf("[%llu][7]count1 = %llu count2 = %llu\n", Coroutine.GetMillisecond(), tv1, tv2);
 }
 
+volatile uint64_t g_late_sum   = 0;
+volatile uint64_t g_late_count = 0;
+volatile uint64_t g_late_max   = 0;
+
+static void Task_Latency(void *obj)
+{
+    while (true) {
+        uint64_t us  = (rand() % 4500) + 500;
+        uint64_t now = Coroutine.GetMicrosecond();
+        Coroutine.YieldDelayUs(us);
+        uint64_t late = Coroutine.GetMicrosecond() - now - us;
+        g_late_sum += late;
+        g_late_count++;
+        if (late > g_late_max) g_late_max = late;
+    }
+    return;
+}
+
+void PrintIdle(void)
+{
+    static uint64_t last_cpu  = 0;
+    static uint64_t last_time = 0;
+    struct rusage   usage;
+    getrusage(RUSAGE_SELF, &usage);
+    uint64_t cpu = (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 +
+                   usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+    uint64_t now   = Coroutine.GetMicrosecond();
+    uint64_t count = g_late_count;
+    printf("[%llu][idle]cpu = %.1f%% wake late avg = %llu us max = %llu us\n",
+           Coroutine.GetMillisecond(),
+           last_time == 0 ? 0.0 : (cpu - last_cpu) * 100.0 / (now - last_time),
+           count == 0 ? 0 : g_late_sum / count,
+           g_late_max);
+    last_cpu     = cpu;
+    last_time    = now;
+    g_late_sum   = 0;
+    g_late_count = 0;
+    g_late_max   = 0;
+}
+
 static void Task_Channel_1(void *obj)
 {
     Coroutine_Channel ch    = (Coroutine_Channel)obj;
@@ -250,17 +319,36 @@ void *RUNTask_Test(void *obj)
     }
 }
 
+#ifndef BENCH
 COROUTINE_INIT_REG_TASK("Task1", Task1, NULL, 16 << 10);
+#endif
 
 #define CH_NUM 4
 static Coroutine_TaskId task_ch1[CH_NUM * 2];
 
 static void *RUNTask_Init(void *obj)
 {
+    extern const Coroutine_Inter *GetInter(void);
+    extern bool                   Bench_Start(void);
+    if (Bench_Start()) {
+        // 基准测试，不运行演示任务
+        StartControllers(RUNTask);
+        return nullptr;
+    }
+
     sem1  = Coroutine.CreateSemaphore("sem1", 0);
     mail1 = Coroutine.CreateMailbox("mail1", 1024);
     lock  = Coroutine.CreateMutex("lock");
 
+    Coroutine.AddTask(Task_Latency, nullptr, TASK_PRI_NORMAL, 0, "Latency", nullptr);
+#if DEMO_YIELD
+    for (size_t i = 0; i < GetInter()->thread_count * 2; i++)
+        Coroutine.AddTask(Task7, nullptr, TASK_PRI_NORMAL, 0, "Task7", nullptr);
+#endif
+#if DEMO_IDLE || DEMO_YIELD
+    StartControllers(RUNTask);
+    return nullptr;
+#endif
 
     static int num        = 0;
     static int num71      = 0;
@@ -292,10 +380,7 @@ static void *RUNTask_Init(void *obj)
         Coroutine.AddTask(Task_Channel_2, ch, TASK_PRI_NORMAL, stack_size, "Channel-2", &task_ch1[i * 2 + 1]);
     }
 
-    extern const Coroutine_Inter *GetInter(void);
-    auto                          inter = GetInter();
-    for (size_t i = 0; i < inter->thread_count; i++)
-        RunTask(RUNTask, nullptr);
+    StartControllers(RUNTask);
     return nullptr;
 }
 
@@ -328,17 +413,24 @@ int main()
     // RunTask(RUNTask_Test, nullptr);
     // RunTask(RUNTask_TestCount, nullptr);
 
+#if DEMO_MS_INTERRUPT
     struct timespec tv;
     tv.tv_sec    = 0;
     tv.tv_nsec   = 1000000;   // 1毫秒
     uint64_t now = Coroutine.GetMillisecond();
+#endif
     while (true) {
+#if DEMO_MS_INTERRUPT
         nanosleep(&tv, NULL);
         Coroutine.MillisecondInterrupt();
-        if (Coroutine.GetMillisecond() - now >= 1000) {
-            now = Coroutine.GetMillisecond();
-            PrintCount();
-        }
+        if (Coroutine.GetMillisecond() - now < 1000)
+            continue;
+        now = Coroutine.GetMillisecond();
+#else
+        Sleep(1000);
+#endif
+        PrintCount();
+        PrintIdle();
     }
     return 0;
 }
@@ -36,6 +36,38 @@
 #include <net/if_arp.h>
 #include <netinet/tcp.h>
 #include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <vector>
+#include <atomic>
+#include <map>
+#include <mutex>
+
+// 空闲等待：1 futex(绝对超时 CLOCK_MONOTONIC)，0 条件变量
+#ifndef PORT_IDLE_FUTEX
+#define PORT_IDLE_FUTEX 1
+#endif
+
+// 按控制器停放/唤醒(park/unpark)：1 每个控制器一个 futex，0 使用共享的 Idle/wake
+#ifndef PORT_PARK
+#define PORT_PARK 1
+#endif
+
+// 微秒时钟使用 CLOCK_MONOTONIC_COARSE(读取更快，休眠到期精度为内核节拍)，0：使用精确的 CLOCK_MONOTONIC
+// NUMA 局部性测试默认用精确时钟：粗粒度时钟下同一节拍到期的任务成批唤醒，本节点来不及处理的由其他节点窃取
+#ifndef PORT_CLOCK_COARSE
+#if BENCH_NUMA
+#define PORT_CLOCK_COARSE 0
+#else
+#define PORT_CLOCK_COARSE 1
+#endif
+#endif
+
+// 控制器弹性伸缩采样间隔 ms，0：关闭(上限由环境变量 COROUTINE_THREADS_MAX 指定)
+#ifndef PORT_AUTOSCALE_MS
+#define PORT_AUTOSCALE_MS 0
+#endif
 
 typedef struct
 {
@@ -51,12 +83,24 @@ struct
 void *memory_critical_section = nullptr;
 void *critical_section        = nullptr;
 
+// 毫秒时钟：单调粗粒度时钟(vDSO，不进入内核)，精度为内核时钟节拍(通常 1~4ms)
 static uint64_t GetMillisecond()
 {
-    struct timeval ts = {0};
-    gettimeofday(&ts, NULL);
-    uint64_t now = ts.tv_sec * 1000 + (ts.tv_usec / 1000);
-    return now;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// 微秒时钟：默认使用粗粒度单调时钟(到期误差为节拍)；PORT_CLOCK_COARSE=0 时改用精确单调时钟
+static uint64_t GetMicrosecond()
+{
+    struct timespec ts;
+#if PORT_CLOCK_COARSE
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
 }
 
 static void *__CreateLock(void)
@@ -114,6 +158,107 @@ static void *_Malloc(size_t size, const char *file, int line)
     return ptr + 1;
 }
 
+// --------------------------------------------------------------------------------------
+//                              |       任务栈        |
+// --------------------------------------------------------------------------------------
+
+#define STACK_CLASS_NUM  32    // 栈尺寸等级数(2^n 页)
+#define STACK_POOL_LIMIT 256   // 每个等级最多缓存栈数量
+
+static pthread_mutex_t    stack_mutex = PTHREAD_MUTEX_INITIALIZER;
+static std::vector<void *> stack_pool[STACK_CLASS_NUM];   // 空闲栈(按尺寸等级)
+
+static size_t StackPageSize(void)
+{
+    static size_t page = 0;
+    if (page == 0)
+        page = (size_t)sysconf(_SC_PAGESIZE);
+    return page;
+}
+
+/**
+ * @brief    分配任务栈：mmap 按需提交，栈底放 PROT_NONE 保护页
+ * @param    size           [in]需要的字节数 [out]实际可用字节数(2^n 页)
+ * @return   void*          栈底
+ * @date     2026-10-17
+ */
+static void *_AllocStack(size_t *size)
+{
+    static unsigned color = 0;
+    size_t          page  = StackPageSize();
+    int             level = 0;
+    while (level < STACK_CLASS_NUM - 1 && (page << level) < *size)
+        level++;
+    // 栈顶按 64 字节错开(着色)，避免各任务栈顶落在相同缓存组
+    *size       = (page << level) - (__atomic_fetch_add(&color, 1, __ATOMIC_RELAXED) % 16) * 64;
+    void *stack = nullptr;
+    pthread_mutex_lock(&stack_mutex);
+    if (!stack_pool[level].empty()) {
+        stack = stack_pool[level].back();
+        stack_pool[level].pop_back();
+    }
+    pthread_mutex_unlock(&stack_mutex);
+    if (stack != nullptr)
+        return stack;
+    char *p = (char *)mmap(nullptr, (page << level) + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED)
+        return nullptr;
+    mprotect(p, page, PROT_NONE);   // 保护页，栈溢出触发 SIGSEGV
+    return p + page;
+}
+
+/**
+ * @brief    释放任务栈：归还已提交的页，放入空闲池
+ * @param    stack
+ * @param    size
+ * @date     2026-10-17
+ */
+static void _FreeStack(void *stack, size_t size)
+{
+    size_t page  = StackPageSize();
+    int    level = 0;
+    while ((page << level) < size)
+        level++;
+    size = page << level;
+    // 保留栈顶页(哨兵和初始帧)，其余归还系统，重新使用时高水位从零统计
+    if (size > page)
+        madvise(stack, size - page, MADV_DONTNEED);
+    pthread_mutex_lock(&stack_mutex);
+    if (stack_pool[level].size() < STACK_POOL_LIMIT) {
+        stack_pool[level].push_back(stack);
+        stack = nullptr;
+    }
+    pthread_mutex_unlock(&stack_mutex);
+    if (stack != nullptr)
+        munmap((char *)stack - page, size + page);
+    return;
+}
+
+/**
+ * @brief    统计栈高水位：mincore 查找最低的已提交页
+ * @param    stack
+ * @param    size
+ * @return   size_t         字节
+ * @date     2026-10-17
+ */
+static size_t _StackUsage(const void *stack, size_t size)
+{
+    size_t        page  = StackPageSize();
+    size_t        pages = (size + page - 1) / page;
+    unsigned char vec[256];
+    for (size_t i = 0; i < pages;) {
+        size_t n = pages - i > sizeof(vec) ? sizeof(vec) : pages - i;
+        if (mincore((char *)stack + i * page, n * page, vec) != 0)
+            return 0;
+        for (size_t j = 0; j < n; j++) {
+            if (vec[j] & 1)
+                return size - (i + j) * page;   // 包含栈顶着色偏移以下的整页
+        }
+        i += n;
+    }
+    return 0;
+}
+
 static size_t GetThreadId(void)
 {
     static __thread pid_t cached_tid = 0;
@@ -137,6 +282,50 @@ void Sleep(uint32_t time)
 
 #define MAX_THREADS 5
 
+static void GetAbsTime(uint64_t us, struct timespec *ts)
+{
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    ts->tv_sec += us / 1000000;
+    ts->tv_nsec += (us % 1000000) * 1000;
+    if (ts->tv_nsec >= 1000000000) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+    return;
+}
+
+#if PORT_IDLE_FUTEX
+class IdleNode {
+public:
+    std::atomic<uint32_t> seq{0};       // 唤醒序号
+    std::atomic<int>      isWait{0};    // 等待数量
+    volatile int          sleep_count = 0;
+    volatile int          waked_count = 0;
+
+    void Idle(uint64_t us)
+    {
+        struct timespec outtime;
+        uint32_t        s = seq.load();
+        isWait++;
+        sleep_count++;
+        if (us != UINT64_MAX)
+            GetAbsTime(us, &outtime);
+        // 序号变化时立即返回，不会丢失唤醒
+        syscall(SYS_futex, &seq, FUTEX_WAIT_BITSET_PRIVATE, s, us == UINT64_MAX ? NULL : &outtime, NULL, FUTEX_BITSET_MATCH_ANY);
+        isWait--;
+        return;
+    }
+
+    void WeakUp()
+    {
+        seq++;
+        waked_count++;
+        if (isWait.load() > 0)
+            syscall(SYS_futex, &seq, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        return;
+    }
+};
+#else
 class IdleNode {
 public:
     pthread_cond_t  g_cond;
@@ -147,28 +336,27 @@ public:
 
     IdleNode()
     {
-        pthread_cond_init(&g_cond, NULL);
+        pthread_condattr_t attr;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&g_cond, &attr);
+        pthread_condattr_destroy(&attr);
         pthread_mutex_init(&g_mutex, NULL);
         return;
     }
 
-    void Idle(uint32_t time)
+    void Idle(uint64_t us)
     {
-        struct timeval  now;
         struct timespec outtime;
-        gettimeofday(&now, NULL);
-        now.tv_sec += time / 1000;
-        now.tv_usec += (time % 1000) * 1000;
-        if (now.tv_usec >= 1000000) {
-            now.tv_sec++;
-            now.tv_usec -= 1000000;
-        }
-        outtime.tv_sec  = now.tv_sec;
-        outtime.tv_nsec = now.tv_usec * 1000;
+        if (us != UINT64_MAX)
+            GetAbsTime(us, &outtime);
         pthread_mutex_lock(&g_mutex);
         isWait++;
         sleep_count++;
-        pthread_cond_timedwait(&g_cond, &g_mutex, &outtime);
+        if (us == UINT64_MAX)
+            pthread_cond_wait(&g_cond, &g_mutex);
+        else
+            pthread_cond_timedwait(&g_cond, &g_mutex, &outtime);
         isWait--;
         pthread_mutex_unlock(&g_mutex);
         return;
@@ -183,11 +371,60 @@ public:
         return;
     }
 };
+#endif
 
 static IdleNode *idle_node = nullptr;
 
+#if PORT_PARK
+/**
+ * @brief    控制器停放节点(futex)
+ * @note     state 1 表示已有唤醒令牌：先 unpark 后 park 时 park 立即返回
+ * @date     2026-10-17
+ */
+class ParkNode {
+public:
+    std::atomic<uint32_t> state{0};
+
+    void Park(uint64_t us)
+    {
+        struct timespec outtime;
+        if (state.exchange(0) == 1)
+            return;   // 已有唤醒令牌
+        if (us != UINT64_MAX)
+            GetAbsTime(us, &outtime);
+        syscall(SYS_futex, &state, FUTEX_WAIT_BITSET_PRIVATE, 0, us == UINT64_MAX ? NULL : &outtime, NULL, FUTEX_BITSET_MATCH_ANY);
+        state.store(0);
+        return;
+    }
+
+    void Unpark()
+    {
+        if (state.exchange(1) == 0)
+            syscall(SYS_futex, &state, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        return;
+    }
+};
+#endif
+
+/**
+ * @brief    调度实例的等待节点(events.object，每个实例一份)
+ * @date     2026-10-17
+ */
+typedef struct
+{
+    IdleNode *idle;   // 共享空闲等待
+#if PORT_PARK
+    ParkNode *park;   // 控制器停放 [thread_count]
+#endif
+} PortNodes;
+
+static PortNodes default_nodes;
+
+#define IDLE_NODE(object) (((PortNodes *)(object))->idle)
+#define PARK_NODE(object) (((PortNodes *)(object))->park)
+
 static Coroutine_Events events = {
-    nullptr,
+    &default_nodes,
     [](void *object) -> void {
         // sched_yield();
         return;
@@ -196,11 +433,11 @@ static Coroutine_Events events = {
         if (time == 0)
             sched_yield();
         else
-            idle_node->Idle(time);
+            IDLE_NODE(object)->Idle((uint64_t)time * 1000);
         return;
     },
     [](void *object) -> void {
-        idle_node->WeakUp();
+        IDLE_NODE(object)->WeakUp();
         return;
     },
     [](void                      *object,
@@ -212,6 +449,9 @@ static Coroutine_Events events = {
             case CO_ERR_WATCHDOG_TIMEOUT:
                 printf("task %p watchdog timeout\n", pars->watchdog_timeout.taskId);
                 break;
+            case CO_ERR_RWLOCK_RELIEVE:
+                printf("task %p unlock rwlock %p not held\n", pars->rwlock_relieve.taskId, pars->rwlock_relieve.rwlock);
+                break;
             default:
                 break;
         }
@@ -219,9 +459,180 @@ static Coroutine_Events events = {
             Sleep(1000);
         return;
     },
+    [](uint64_t time, void *object) -> void {
+        // 休眠到下一个到期时间
+        if (time == 0)
+            sched_yield();
+        else
+            IDLE_NODE(object)->Idle(time);
+        return;
+    },
+#if PORT_PARK
+    [](uint16_t co_id, uint64_t time, void *object) -> void {
+        if (time == 0)
+            sched_yield();
+        else
+            PARK_NODE(object)[co_id].Park(time);
+        return;
+    },
+    [](uint16_t co_id, void *object) -> void {
+        PARK_NODE(object)[co_id].Unpark();
+        return;
+    },
+#endif
 };
 
-static const Coroutine_Inter Inter = {
+// --------------------------------------------------------------------------------------
+//                              |       NUMA        |
+// --------------------------------------------------------------------------------------
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+#ifndef MPOL_MF_MOVE
+#define MPOL_MF_MOVE (1 << 1)
+#endif
+
+static int                           numa_nodes = 0;       // 节点数量(0：未初始化)
+static bool                          numa_fake  = false;   // 模拟拓扑(不绑定内存)
+static std::atomic<bool>             numa_mbind{true};     // 内核支持 mbind/set_mempolicy
+static std::vector<std::vector<int>> numa_cpus;            // 各节点的 CPU
+static std::mutex                    numa_fake_lock;
+static std::map<size_t, std::pair<size_t, uint16_t>> numa_fake_binds;   // 模拟拓扑时记录的绑定 起始地址：(结束地址, 节点)
+
+/**
+ * @brief    读取 NUMA 拓扑(/sys/devices/system/node/nodeN/cpulist)
+ * @note     环境变量 COROUTINE_NUMA_FAKE=n 模拟 n 个节点(CPU 平分，只影响分组和线程绑定)
+ * @date     2026-10-17
+ */
+static void NumaInit(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus <= 0) cpus = 1;
+    const char *fake = getenv("COROUTINE_NUMA_FAKE");
+    if (fake != nullptr && atoi(fake) > 1) {
+        numa_fake  = true;
+        numa_nodes = atoi(fake);
+        numa_cpus.assign(numa_nodes, std::vector<int>());
+        for (int i = 0; i < numa_nodes; i++) {
+            for (long cpu = (long)i * cpus / numa_nodes; cpu < (long)(i + 1) * cpus / numa_nodes; cpu++)
+                numa_cpus[i].push_back(cpu);
+            if (numa_cpus[i].empty())
+                numa_cpus[i].push_back(i % cpus);   // 节点多于 CPU 时共用
+        }
+        return;
+    }
+    for (int node = 0;; node++) {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        FILE *fp = fopen(path, "r");
+        if (fp == nullptr)
+            break;
+        // 格式：0-3,8-11
+        std::vector<int> list;
+        int              a, b;
+        while (fscanf(fp, "%d", &a) == 1) {
+            b = a;
+            if (fscanf(fp, "-%d", &b) != 1)
+                b = a;
+            for (int cpu = a; cpu <= b; cpu++)
+                list.push_back(cpu);
+            if (fgetc(fp) != ',')
+                break;
+        }
+        fclose(fp);
+        numa_cpus.push_back(list);
+    }
+    numa_nodes = numa_cpus.empty() ? 1 : numa_cpus.size();
+    return;
+}
+
+static uint16_t GetNode(uint16_t co_id)
+{
+    if (numa_nodes == 0) NumaInit();
+    return numa_nodes <= 1 ? 0 : co_id % numa_nodes;   // 控制器轮流分配到各节点
+}
+
+/**
+ * @brief    控制器线程绑定到节点的 CPU，内存优先从该节点分配
+ * @param    co_id          控制器id
+ * @param    node           节点
+ * @date     2026-10-17
+ */
+static void BindThread(uint16_t co_id, uint16_t node)
+{
+    if (numa_nodes <= 1 || node >= numa_cpus.size() || numa_cpus[node].empty())
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    const char *pin = getenv("COROUTINE_PIN_CPU");
+    if (pin != nullptr && atoi(pin) != 0)
+        CPU_SET(numa_cpus[node][co_id / numa_nodes % numa_cpus[node].size()], &set);   // 节点内轮流绑定一个 CPU
+    else
+        for (int cpu : numa_cpus[node])
+            CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (numa_fake || !numa_mbind)
+        return;
+    unsigned long mask = 1UL << node;
+    if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &mask, sizeof(mask) * 8) != 0 && errno == ENOSYS)
+        numa_mbind = false;   // 内核不支持，不再绑定
+    return;
+}
+
+/**
+ * @brief    任务栈绑定到节点(已提交的页迁移过去，之后按需提交的页从该节点分配)
+ * @param    mem
+ * @param    size
+ * @param    node
+ * @date     2026-10-17
+ */
+static void BindMemory(void *mem, size_t size, uint16_t node)
+{
+    if (numa_fake) {
+        // 只记录，供基准测试检查(替换重叠的旧记录)
+        std::lock_guard<std::mutex> lock(numa_fake_lock);
+        size_t                      start = (size_t)mem, end = start + size;
+        auto                        it    = numa_fake_binds.lower_bound(start);
+        if (it != numa_fake_binds.begin() && std::prev(it)->second.first > start)
+            it--;
+        while (it != numa_fake_binds.end() && it->first < end)
+            it = numa_fake_binds.erase(it);
+        numa_fake_binds[start] = std::make_pair(end, node);
+        return;
+    }
+    if (!numa_mbind || node >= sizeof(unsigned long) * 8)
+        return;
+    // mbind 按页处理，只绑定完整的页
+    size_t page  = sysconf(_SC_PAGESIZE);
+    size_t start = ((size_t)mem + page - 1) & ~(page - 1);
+    size_t end   = ((size_t)mem + size) & ~(page - 1);
+    if (end <= start)
+        return;
+    unsigned long mask = 1UL << node;
+    if (syscall(SYS_mbind, start, end - start, MPOL_PREFERRED, &mask, sizeof(mask) * 8, MPOL_MF_MOVE) != 0 && errno == ENOSYS)
+        numa_mbind = false;
+    return;
+}
+
+/**
+ * @brief    查询模拟拓扑时地址所在的绑定节点(基准测试检查 BindMemory)
+ * @param    addr
+ * @param    node           绑定的节点
+ * @return   true           已绑定
+ * @date     2026-10-18
+ */
+bool PortNumaFakeNode(const void *addr, uint16_t *node)
+{
+    std::lock_guard<std::mutex> lock(numa_fake_lock);
+    auto                        it = numa_fake_binds.upper_bound((size_t)addr);
+    if (it == numa_fake_binds.begin() || (--it)->second.first <= (size_t)addr)
+        return false;
+    *node = it->second.second;
+    return true;
+}
+
+static Coroutine_Inter Inter = {
     MAX_THREADS,
     __Lock,
     __UnLock,
@@ -230,17 +641,83 @@ static const Coroutine_Inter Inter = {
     GetMillisecond,
     GetThreadId,
     &events,
+    _AllocStack,
+    _FreeStack,
+    _StackUsage,
+    GetMicrosecond,
+    0,
+    GetNode,
+    BindThread,
+    BindMemory,
 };
 
 
 const Coroutine_Inter *GetInter(void)
 {
+    if (idle_node != nullptr)
+        return &Inter;   // 已初始化(演示和基准中多次调用)
     memory_critical_section = __CreateLock();
     critical_section        = __CreateLock();
     idle_node               = new IdleNode();
+    default_nodes.idle      = idle_node;
+    // 环境变量 COROUTINE_THREADS 指定协程控制器(线程)数量
+    const char *threads = getenv("COROUTINE_THREADS");
+    if (threads != nullptr && atoi(threads) > 0)
+        Inter.thread_count = atoi(threads);
+    // 环境变量 COROUTINE_THREADS_MAX 指定控制器上限，超出初始数量的控制器由 AddController 启用
+    const char *threads_max = getenv("COROUTINE_THREADS_MAX");
+    if (threads_max != nullptr && (size_t)atoi(threads_max) > Inter.thread_count) {
+        Inter.thread_init  = Inter.thread_count;
+        Inter.thread_count = atoi(threads_max);
+    }
+#if PORT_PARK
+    default_nodes.park = new ParkNode[Inter.thread_count];
+#endif
     return &Inter;
 }
 
+/**
+ * @brief    创建调度实例的外部接口(CreateInstance)，空闲和停放节点独立
+ * @param    thread_count   控制器数量
+ * @return   const Coroutine_Inter*
+ * @date     2026-10-17
+ */
+const Coroutine_Inter *NewInter(size_t thread_count)
+{
+    GetInter();
+    PortNodes *nodes = new PortNodes();
+    nodes->idle      = new IdleNode();
+#if PORT_PARK
+    nodes->park = new ParkNode[thread_count];
+#endif
+    Coroutine_Events *ev = new Coroutine_Events(events);
+    ev->object           = nodes;
+    Coroutine_Inter *inter = new Coroutine_Inter(Inter);
+    inter->thread_count    = thread_count;
+    inter->thread_init     = 0;
+    inter->events          = ev;
+    return inter;
+}
+
+/**
+ * @brief    将当前线程绑定到 CPU(环境变量 COROUTINE_PIN_CPU=1 时按调用顺序轮流绑定)
+ * @date     2026-10-17
+ */
+void PinThread(void)
+{
+    static std::atomic<int> next{0};
+    const char *            pin = getenv("COROUTINE_PIN_CPU");
+    if (pin == nullptr || atoi(pin) == 0)
+        return;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus <= 0) cpus = 1;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(next++ % cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    return;
+}
+
 void RunTask(void *(*func)(void *arg), void *arg)
 {
     // 创建线程
@@ -256,6 +733,74 @@ void RunTask(void *(*func)(void *arg), void *arg)
     return;
 }
 
+#if PORT_AUTOSCALE_MS
+/**
+ * @brief    弹性伸缩线程：就绪任务堆积且几乎不空闲时启用控制器，持续空闲时退役编号最大的控制器
+ * @note     空闲比例来自 sleep_time，需要 COROUTINE_ENABLE_PRINT_INFO，否则只会扩容
+ * @param    arg            控制器线程函数
+ * @date     2026-10-17
+ */
+static void *AutoScale(void *arg)
+{
+    auto                  func = (void *(*)(void *))arg;
+    size_t                num  = Inter.thread_count;
+    std::vector<uint64_t> last_sleep(num, 0), last_run(num, 0);
+    int                   idle_rounds = 0;
+    while (true) {
+        Sleep(PORT_AUTOSCALE_MS);
+        uint64_t sleep = 0, run = 0;
+        size_t   depth = 0, active = 0;
+        int      last_active = -1;
+        for (size_t i = 0; i < num; i++) {
+            Coroutine_ControllerInfo info;
+            if (!Coroutine.GetControllerInfo(i, &info) || !info.isBound)
+                continue;
+            if (info.isActive) {
+                sleep += info.sleep_time - last_sleep[i];
+                run += info.run_time - last_run[i];
+                depth += info.run_count;
+                active++;
+                last_active = i;
+            }
+            last_sleep[i] = info.sleep_time;
+            last_run[i]   = info.run_time;
+        }
+        if (active == 0 || run == 0)
+            continue;
+        uint64_t idle = sleep * 100 / run;   // 空闲百分比
+        if (depth >= active * 2 && idle < 10) {
+            bool isNew = false;
+            if (Coroutine.AddController(&isNew) >= 0 && isNew)
+                RunTask(func, nullptr);
+            idle_rounds = 0;
+        } else if (idle > 80) {
+            if (++idle_rounds >= 3 && last_active > 0) {
+                Coroutine.RetireController(last_active);
+                idle_rounds = 0;
+            }
+        } else
+            idle_rounds = 0;
+    }
+    return nullptr;
+}
+#endif
+
+/**
+ * @brief    创建初始控制器线程(PORT_AUTOSCALE_MS 非 0 时同时启动弹性伸缩线程)
+ * @param    func           控制器线程函数(循环调用 RunTick/RunTicks)
+ * @date     2026-10-17
+ */
+void StartControllers(void *(*func)(void *arg))
+{
+    size_t num = Inter.thread_init ? Inter.thread_init : Inter.thread_count;
+    for (size_t i = 0; i < num; i++)
+        RunTask(func, nullptr);
+#if PORT_AUTOSCALE_MS
+    RunTask(AutoScale, (void *)func);
+#endif
+    return;
+}
+
 void PrintMemory(void)
 {
     printf("Memory used: %d bytes, max used: %d bytes\n", memory.used, memory.max_used);
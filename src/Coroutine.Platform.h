@@ -22,13 +22,18 @@
 
 #define CONTEXT_JMP      1   // setjmp / longjmp
 #define CONTEXT_UCONTEXT 2   // getcontext / swapcontext
+#define CONTEXT_ASM      3   // 汇编切换(只保存被调用者保存寄存器，无系统调用)
 
 // 上下文切换模式
-#if defined(__linux__)
+#ifndef COROUTINE_CONTEXT_MODE
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+#define COROUTINE_CONTEXT_MODE CONTEXT_ASM
+#elif defined(__linux__)
 #define COROUTINE_CONTEXT_MODE CONTEXT_UCONTEXT
 #else
 #define COROUTINE_CONTEXT_MODE CONTEXT_JMP
 #endif
+#endif
 
 // --------------------------------------------------------------------------------------
 //                              |   跳转处理    |
@@ -37,6 +42,8 @@
 #if COROUTINE_CONTEXT_MODE == CONTEXT_UCONTEXT
 #include <ucontext.h>
 typedef ucontext_t jmp_buf;
+#elif COROUTINE_CONTEXT_MODE == CONTEXT_ASM
+typedef void *jmp_buf[1];   // 保存的栈指针，寄存器保存在栈上
 #else
 #ifdef WIN32
 typedef uint32_t jmp_buf[6];
@@ -210,3 +217,143 @@ static inline void coroutine_enter_task(void *func, void *arg, int *stack)
 #endif
 #endif
 // clang-format on
+
+// --------------------------------------------------------------------------------------
+//                              |   汇编上下文切换    |
+// --------------------------------------------------------------------------------------
+
+#if COROUTINE_CONTEXT_MODE == CONTEXT_ASM
+/**
+ * @brief    上下文切换：把被调用者保存寄存器压入当前栈，栈指针写入 from，再从 to 恢复
+ * @param    from           保存当前栈指针
+ * @param    to             目标栈指针
+ * @date     2026-10-17
+ */
+extern void coroutine_context_switch(void **from, void *to) __asm__("coroutine_context_switch");
+
+/**
+ * @brief    首次进入任务的入口，从保存的寄存器中取出函数和参数
+ * @date     2026-10-17
+ */
+extern void coroutine_context_entry(void) __asm__("coroutine_context_entry");
+
+// clang-format off
+#if defined(__x86_64__) // x86_64: rbp rbx r12-r15 + mxcsr/x87 控制字
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    ".globl coroutine_context_switch\n"
+    ".hidden coroutine_context_switch\n"
+    ".type coroutine_context_switch, @function\n"
+    "coroutine_context_switch:\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"     // 保存当前栈
+    "    movq %rsi, %rsp\n"       // 切换栈
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".size coroutine_context_switch, .-coroutine_context_switch\n"
+    ".p2align 4\n"
+    ".globl coroutine_context_entry\n"
+    ".hidden coroutine_context_entry\n"
+    ".type coroutine_context_entry, @function\n"
+    "coroutine_context_entry:\n"
+    "    movq %r12, %rdi\n"       // 参数
+    "    callq *%r13\n"           // 调用函数
+    "    ud2\n"                   // 任务函数不会返回
+    ".size coroutine_context_entry, .-coroutine_context_entry\n");
+#elif defined(__aarch64__) // aarch64: x19-x30 + d8-d15
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    ".globl coroutine_context_switch\n"
+    ".hidden coroutine_context_switch\n"
+    ".type coroutine_context_switch, %function\n"
+    "coroutine_context_switch:\n"
+    "    sub sp, sp, #160\n"
+    "    stp x19, x20, [sp, #0]\n"
+    "    stp x21, x22, [sp, #16]\n"
+    "    stp x23, x24, [sp, #32]\n"
+    "    stp x25, x26, [sp, #48]\n"
+    "    stp x27, x28, [sp, #64]\n"
+    "    stp x29, x30, [sp, #80]\n"
+    "    stp d8, d9, [sp, #96]\n"
+    "    stp d10, d11, [sp, #112]\n"
+    "    stp d12, d13, [sp, #128]\n"
+    "    stp d14, d15, [sp, #144]\n"
+    "    mov x2, sp\n"
+    "    str x2, [x0]\n"          // 保存当前栈
+    "    mov sp, x1\n"            // 切换栈
+    "    ldp x19, x20, [sp, #0]\n"
+    "    ldp x21, x22, [sp, #16]\n"
+    "    ldp x23, x24, [sp, #32]\n"
+    "    ldp x25, x26, [sp, #48]\n"
+    "    ldp x27, x28, [sp, #64]\n"
+    "    ldp x29, x30, [sp, #80]\n"
+    "    ldp d8, d9, [sp, #96]\n"
+    "    ldp d10, d11, [sp, #112]\n"
+    "    ldp d12, d13, [sp, #128]\n"
+    "    ldp d14, d15, [sp, #144]\n"
+    "    add sp, sp, #160\n"
+    "    ret\n"
+    ".size coroutine_context_switch, .-coroutine_context_switch\n"
+    ".p2align 4\n"
+    ".globl coroutine_context_entry\n"
+    ".hidden coroutine_context_entry\n"
+    ".type coroutine_context_entry, %function\n"
+    "coroutine_context_entry:\n"
+    "    mov x0, x19\n"           // 参数
+    "    blr x20\n"               // 调用函数
+    "    brk #0\n"                // 任务函数不会返回
+    ".size coroutine_context_entry, .-coroutine_context_entry\n");
+#else
+#error "Coroutine.Platform: CONTEXT_ASM unsupported platform!"
+#endif
+// clang-format on
+
+/**
+ * @brief    在新栈上构造首次切换用的寄存器帧
+ * @param    top            栈顶(高地址)
+ * @param    func           任务函数
+ * @param    arg            任务参数
+ * @return   void*          初始栈指针，作为 coroutine_context_switch 的 to
+ * @date     2026-10-17
+ */
+static inline void *coroutine_context_make(void *top, void (*func)(void *), void *arg)
+{
+    uint64_t *sp = (uint64_t *)((size_t)top & ~(size_t)15);   // 16 字节对齐
+#if defined(__x86_64__)
+    sp -= 8;
+    sp[0] = 0x037F00001F80ULL;                  // mxcsr = 0x1F80, x87 控制字 = 0x037F
+    sp[1] = 0;                                  // r15
+    sp[2] = 0;                                  // r14
+    sp[3] = (uint64_t)(size_t)func;             // r13
+    sp[4] = (uint64_t)(size_t)arg;              // r12
+    sp[5] = 0;                                  // rbx
+    sp[6] = 0;                                  // rbp
+    sp[7] = (uint64_t)(size_t)coroutine_context_entry;   // 返回地址
+#elif defined(__aarch64__)
+    sp -= 20;
+    memset(sp, 0, 20 * sizeof(uint64_t));
+    sp[0]  = (uint64_t)(size_t)arg;                       // x19
+    sp[1]  = (uint64_t)(size_t)func;                      // x20
+    sp[11] = (uint64_t)(size_t)coroutine_context_entry;   // x30
+#endif
+    return sp;
+}
+#endif
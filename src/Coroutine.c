@@ -16,7 +16,48 @@ typedef int STACK_TYPE;   // 栈类型
 #define STACK_SENTRY_END   0xA5A5A5A5   // 栈哨兵
 
 #define MAX_PRIORITY_NUM 5   // 最大优先级数
-#define DELAY_CHECK      0   // 延时检查间隔 ms
+#define TASK_POOL_CLASS  8   // 任务缓存栈大小分类数
+#define DELAY_CHECK      0   // 延时检查间隔 ms，0：不等待(粗粒度时钟同一节拍内读数不变)
+
+// 每个控制器每个优先级的无锁就绪队列容量(2的幂)，满了放入远程列表
+#if defined(_ARMABI)
+#define RUN_QUEUE_SIZE 16
+#else
+#define RUN_QUEUE_SIZE 256
+#endif
+
+// 就绪位图中最高优先级(最低置位)
+#if defined(__GNUC__) || defined(__clang__)
+#define CO_BITMAP_FIRST(bitmap)   __builtin_ctz(bitmap)
+#define CO_BITMAP64_FIRST(bitmap) __builtin_ctzll(bitmap)
+#else
+static inline int CO_BITMAP_FIRST(uint32_t bitmap)
+{
+    int i = 0;
+    while (!(bitmap & 1)) {
+        bitmap >>= 1;
+        i++;
+    }
+    return i;
+}
+static inline int CO_BITMAP64_FIRST(uint64_t bitmap)
+{
+    int i = 0;
+    while (!(bitmap & 1)) {
+        bitmap >>= 1;
+        i++;
+    }
+    return i;
+}
+#endif
+
+#if COROUTINE_SLEEP_WHEEL
+#define WHEEL_BITS     6                                       // 每层槽位数 2^n
+#define WHEEL_SLOTS    (1 << WHEEL_BITS)                       // 每层槽位数
+#define WHEEL_LEVELS   5                                       // 层数
+#define WHEEL_OVERFLOW 0xFFFF                                  // 超出时间轮范围
+#define WHEEL_TICK     (1ULL << COROUTINE_SLEEP_WHEEL_SHIFT)   // 刻度 us
+#endif
 
 // --------------------------------------------------------------------------------------
 //                              |       应用        |
@@ -33,14 +74,44 @@ typedef struct _CO_Watchdog_Node     WatchdogNode;      // 看门狗节点
 typedef struct _CO_Mailbox           CO_Mailbox;        // 邮箱
 typedef struct _CO_ASync             CO_ASync;          // 异步任务
 typedef struct _CO_Mutex             CO_Mutex;          // 互斥锁
+typedef struct _CO_RWLock            CO_RWLock;         // 读写锁
+typedef struct _CO_RWLock_Wait_Node  RWLockWaitNode;    // 读写锁等待节点
+typedef struct _CO_EventGroup        CO_EventGroup;     // 事件组
+typedef struct _CO_Event_Wait_Node   EventWaitNode;     // 事件组等待节点
+typedef struct _CO_Event_Wait_Link   EventWaitLink;     // 事件组等待节点位索引
 typedef struct _CO_Channel           CO_Channel;        // 管道
 typedef struct _CO_Channel_Wait_Node ChannelWaitNode;   // 管道等待节点
 typedef struct _CO_Channel_Data_Node ChannelDataNode;   // 管道数据节点
 typedef struct _CO_TaskRunList       CO_TaskRunList;    // 运行列表
+typedef struct _CO_InboxNode         CO_InboxNode;      // 唤醒收件箱节点
 #if COROUTINE_BLOCK_CRITICAL_SECTION
-typedef volatile atomic_int CO_APP_CS[1];   // 临界区
+typedef struct
+{
+#if COROUTINE_CS_TICKET
+    atomic_uint next;    // 下一个票号
+    atomic_uint owner;   // 当前持有票号
+#else
+    atomic_int lock;   // 0：空闲 1：占用
+#endif
+#if COROUTINE_CS_STATS
+    uint32_t acquire;   // 获取次数
+    uint32_t contend;   // 冲突次数
+    uint64_t spin;      // 自旋次数
+#endif
+} CO_APP_CS_t;
+typedef CO_APP_CS_t CO_APP_CS[1];   // 临界区(全零为初始状态)
+typedef atomic_int          CO_ATOMIC_INT;
+typedef atomic_uint         CO_ATOMIC_U32;
+typedef atomic_size_t       CO_ATOMIC_SIZE;
+typedef atomic_uint_fast64_t CO_ATOMIC_U64;
+#define CO_ATOMIC_PTR(type) _Atomic(type)
 #else
-typedef int CO_APP_CS[1];
+typedef int               CO_APP_CS[1];
+typedef volatile int      CO_ATOMIC_INT;
+typedef volatile uint32_t CO_ATOMIC_U32;
+typedef volatile size_t   CO_ATOMIC_SIZE;
+typedef volatile uint64_t CO_ATOMIC_U64;
+#define CO_ATOMIC_PTR(type) type volatile
 #endif
 
 /**
@@ -97,45 +168,159 @@ struct _CO_Semaphore
 {
     char              name[32];     // 名称
     CM_NodeLinkList_t list;         // 等待列表 SemaphoreNode
-    uint32_t          value;        // 信号值
-    uint32_t          wait_count;   // 等待数
+    CO_ATOMIC_U32     value;        // 信号值(快速路径无锁访问)
+    CO_ATOMIC_U32     wait_count;   // 等待数(只在 cs 内修改)
     CM_NodeLink_t     link;         // _CO_Semaphore
     CO_APP_CS         cs;           // 临界区
+#if COROUTINE_ENABLE_PRINT_INFO
+    CO_ATOMIC_U32 fast_count;   // 快速路径次数
+#endif
 };
 
 struct _CO_Mutex
 {
     char              name[32];
     CM_NodeLinkList_t list;            // 等待列表 MutexWaitNode
-    uint32_t          value;           // 互斥值
-    uint32_t          wait_count;      // 等待数量
+    uint32_t          value;           // 互斥值(只由持有者修改)
+    CO_ATOMIC_U32     wait_count;      // 等待数量(只在 cs 内修改)
     uint32_t          max_wait_time;   // 最大等待时间
     CM_NodeLink_t     link;            // _CO_Mutex
-    CO_TCB *          owner;           // 持有者
+    CO_ATOMIC_PTR(CO_TCB *) owner;     // 持有者(快速路径 CAS)
+    CO_ATOMIC_PTR(CO_Thread *) owner_thread;   // 持有者获取锁时所在控制器 NULL：未知(自旋只比较，不访问持有者)
+    CO_APP_CS cs;                      // 临界区
+#if COROUTINE_MUTEX_INHERIT
+    CM_NodeLink_t owner_link;   // 持有者的持有列表 _CO_Mutex
+#endif
+#if COROUTINE_ENABLE_PRINT_INFO
+    CO_ATOMIC_U32 spin_count;   // 自旋获取次数
+#endif
+};
+
+/**
+ * @brief    读写锁各控制器读者计数(独占缓存行，读者之间不共享写入)
+ * @date     2026-10-18
+ */
+typedef struct
+{
+    CO_ATOMIC_INT count;                            // 读者数
+    uint8_t       pad[64 - sizeof(CO_ATOMIC_INT)];   // 填充
+} CO_RWLockReader;
+
+/**
+ * @brief    读写锁
+ * @date     2026-10-18
+ */
+struct _CO_RWLock
+{
+    char              name[32];
+    CM_NodeLinkList_t list;            // 等待列表 RWLockWaitNode
+    CO_ATOMIC_PTR(CO_TCB *) writer;    // 写者(已获取或正在等待读者退出)
+    CO_ATOMIC_U32     writer_wait;     // 排队的写者数量(写优先时阻止新读者)
+    uint32_t          wait_count;      // 等待数量
+    uint32_t          max_wait_time;   // 最大等待时间
+    uint16_t          reader_num;      // 读者计数数量(控制器容量)
+    bool              isWriterFirst;   // 写优先
+    bool              isDrain;         // 写者正在等待读者退出
+    CM_NodeLink_t     link;            // _CO_RWLock
     CO_APP_CS         cs;              // 临界区
+    CO_RWLockReader   readers[];       // 各控制器读者计数 [reader_num]
+};
+
+struct _CO_RWLock_Wait_Node
+{
+    CM_NodeLink_t link;      // RWLockWaitNode
+    CO_TCB *      task;      // 等待任务
+    bool          isWrite;   // 等待写锁
+};
+
+// 任务持有的读锁
+typedef struct
+{
+    CO_RWLock *rw;      // 读写锁 NULL：空闲
+    uint32_t   count;   // 递归次数
+} CO_RWLockHold;
+
+#define EVENT_BITS       64   // 事件组位数
+#define EVENT_WAIT_LINKS 4    // 等待节点内置位索引数量，等待任意位且位数更多时动态分配
+
+/**
+ * @brief    事件组
+ * @note     等待者按位挂入 lists：等待任意位的挂入每一位，等待全部位的只挂入一个未置位的位；
+ *           设置时只检查 bits 对应列表中的等待者
+ * @date     2026-10-18
+ */
+struct _CO_EventGroup
+{
+    char              name[32];
+    CO_ATOMIC_U64     value;                // 事件位(快速路径无锁访问)
+    CO_ATOMIC_U64     wait_mask;            // 有等待者的位(只在 cs 内修改)
+    uint32_t          wait_count;           // 等待数量
+    uint32_t          max_wait_time;        // 最大等待时间
+    CM_NodeLink_t     link;                 // _CO_EventGroup
+    CO_APP_CS         cs;                   // 临界区
+    CM_NodeLinkList_t lists[EVENT_BITS];    // 各位等待列表 EventWaitLink
+#if COROUTINE_ENABLE_PRINT_INFO
+    CO_ATOMIC_U32 fast_count;   // 快速路径次数(设置时没有等待者)
+#endif
+};
+
+struct _CO_Event_Wait_Link
+{
+    CM_NodeLink_t  link;   // EventWaitLink
+    EventWaitNode *node;   // 所属等待节点
+    uint8_t        bit;    // 所在位
+};
+
+struct _CO_Event_Wait_Node
+{
+    CO_TCB *       task;                            // 等待任务
+    uint64_t       mask;                            // 等待的位
+    uint64_t       result;                          // 命中的位(由设置者填写)
+    bool           isAll;                           // 等待全部位
+    bool           isClear;                         // 满足时清除命中的位
+    uint64_t       time;                            // 开始等待时间 us
+    uint8_t        link_num;                        // 已挂入的位索引数量
+    EventWaitLink *links;                           // 位索引
+    EventWaitLink  inline_links[EVENT_WAIT_LINKS];   // 内置位索引
 };
 
 struct _CO_Mutex_Wait_Node
 {
     CM_NodeLink_t link;    // MutexWaitNode
     CO_Mutex *    mutex;   // 等待互斥锁
-    uint64_t      time;    // 等待时间
+    uint64_t      time;    // 开始等待时间 us
     CO_TCB *      task;    // 等待任务
 };
 
 struct _CO_Watchdog_Node
 {
     CM_RBTree_Link_t link;              // WatchdogNode
-    uint64_t         expiration_time;   // 看门狗过期时间 0：不启用
+    uint64_t         expiration_time;   // 看门狗过期时间 us 0：不启用
     CO_TCB *         task;              // 等待任务
 };
 
+/**
+ * @brief    无锁就绪队列(每个控制器每个优先级一个)
+ * @note     放入(tail)需持有所属控制器临界区；所属控制器从 head 按 FIFO 取出(保证 Yield 轮转公平)，
+ *           只修改 head，不使用 CAS；窃取者在所属控制器临界区内从 tail 取出，
+ *           双方先修改自己的一端再检查另一端，争最后一个任务时所属控制器在临界区内取出
+ * @date     2026-10-17
+ */
 struct _CO_TaskRunList
 {
-    CM_NodeLinkList_t list;         // 运行列表
-    CO_APP_CS         cs;           // 临界区
-    size_t            run_count;    // 运行数量
-    size_t            wake_count;   // 唤醒数量
+    CO_ATOMIC_U32          head;                    // 取出位置
+    CO_ATOMIC_U32          tail;                    // 放入位置
+    uint64_t               serve_time;              // 最近一次取出时间(饥饿检查)
+    CO_ATOMIC_PTR(CO_TCB *) tasks[RUN_QUEUE_SIZE];   // 任务
+};
+
+/**
+ * @brief    唤醒收件箱节点(侵入式 MPSC 队列)
+ * @date     2026-10-17
+ */
+struct _CO_InboxNode
+{
+    CO_ATOMIC_PTR(CO_InboxNode *) next;   // 下一个节点
 };
 
 /**
@@ -146,10 +331,11 @@ struct _CO_TaskRunList
 struct _CO_TCB
 {
     jmp_buf        env;                  // 环境
-    uint64_t       execv_time;           // 执行时间
+    uint64_t       execv_time;           // 执行时间 us
     uint32_t       stack_len;            // 当前栈长度
     uint32_t       stack_max;            // 最大长度
     uint32_t       stack_alloc;          // 分配长度
+    uint32_t       stack_size;           // 申请长度(任务缓存分类)
     uint16_t       isDel : 1;            // 是否删除
     uint16_t       isRun : 1;            // 正在运行
     uint16_t       isWaitMail : 1;       // 正在等待邮件
@@ -161,8 +347,20 @@ struct _CO_TCB
     uint16_t       isAddRunList : 1;     // 添加运行列表
     uint16_t       isAddSleepList : 1;   // 添加睡眠列表
     uint16_t       isRuning : 1;         // 正在运行
+    uint16_t       isStackInter : 1;     // 栈由 Inter.AllocStack 分配(有保护页，按需提交)
+    uint16_t       isAffinityHard : 1;   // 硬亲和：只在 affinity 中的控制器运行
+    uint16_t       isWaitRWLock : 1;     // 等待读写锁
+    uint16_t       isWaitEvent : 1;      // 等待事件组
+    CO_ATOMIC_INT  queued;               // 在无锁就绪队列中 (CAS 1->0 取得任务)
+    CO_ATOMIC_INT  refs;                 // 引用计数: 1(存活) + 就绪队列中的过期项
+    CO_ATOMIC_INT  inboxed;              // 在唤醒收件箱中(取出后清除，期间只能走加锁唤醒)
+    CO_InboxNode   inbox_link;           // 唤醒收件箱节点
+    uint8_t        pri;                  // 当前优先级
+    uint8_t        init_pri;             // 初始优先级
+    Coroutine_Affinity affinity;         // 控制器亲和掩码 bit n: co_id n，0：不限制
+    uint16_t       stack_node;           // 栈所在 NUMA 节点(任务缓存按节点复用)
     Coroutine_Task func;                 // 执行
-    char *         name;                 // 名称
+    char           name[32];             // 名称
     void *         obj;                  // 执行参数
     CO_Thread *    coroutine;            // 父节点
     STACK_TYPE *   stack;                // 栈缓存
@@ -173,13 +371,27 @@ struct _CO_TCB
     uint32_t run_max_timeout;         // 运行超时
     uint32_t run_avg_timeout;         // 运行超时
     uint32_t run_avg_timeout_count;   // 运行超时次数
+    uint32_t migrations;              // 迁移次数(更换控制器)
 #endif
 
     WatchdogNode *watchdog;   // 看门狗节点
+#if COROUTINE_ENABLE_MUTEX && COROUTINE_MUTEX_INHERIT
+    CO_Mutex *        wait_mutex;   // 正在等待的互斥锁(优先级继承沿等待链传递)
+    MutexWaitNode *   wait_node;    // 等待节点(在 wait_mutex->cs 内访问)
+    CM_NodeLinkList_t mutexes;      // 持有的互斥锁 _CO_Mutex
+#endif
+#if COROUTINE_ENABLE_RWLOCK
+    CO_RWLockHold rwlock_holds[COROUTINE_RWLOCK_HOLDS];   // 持有的读锁(只由任务自己访问)
+#endif
 
     CM_NodeLink_t    run_link;         // _CO_TCB , 运行节点
     CM_NodeLink_t    task_list_link;   // 任务列表节点
-    CM_RBTree_Link_t sleep_link;       // 睡眠节点
+#if COROUTINE_SLEEP_WHEEL
+    CM_NodeLink_t sleep_link;   // 睡眠节点(时间轮槽)
+    uint16_t      sleep_slot;   // 时间轮槽 level * WHEEL_SLOTS + slot
+#else
+    CM_RBTree_Link_t sleep_link;   // 睡眠节点
+#endif
 };
 
 /**
@@ -203,12 +415,27 @@ struct _CO_Thread
     uint64_t sleep_start_time;      // 休眠开始时间
     uint64_t schedule_count;        // 调度次数
     uint64_t schedule_start_time;   // schedule_count 记录时间
+    uint32_t steal_count[2];        // 窃取次数 [0]本节点 [1]其他节点
 #endif
 
-    CM_NodeLinkList_t run_tasks;    // 任务列表
-    size_t            run_count;    // 运行数量
-    size_t            wake_count;   // 唤醒数量
-    CO_APP_CS         cs;           // 临界区
+    CO_TaskRunList *  run_list;                      // 无锁就绪队列[MAX_PRIORITY_NUM]
+    CM_NodeLinkList_t run_tasks[MAX_PRIORITY_NUM];   // 溢出列表(就绪队列满时，按优先级)
+    volatile uint8_t  run_bitmap;                    // 就绪位图 bit n: run_list[n]/run_tasks[n] 非空 (在临界区内修改)
+    CO_ATOMIC_SIZE    run_count;                     // 运行数量
+    CO_ATOMIC_SIZE    wake_count;                    // 唤醒数量
+    CO_ATOMIC_INT     isParked;                      // 已停放(park)，等待 unpark
+    CO_ATOMIC_INT     isRetired;                     // 已退役(不分配任务，就绪任务转移到其他控制器)
+    uint16_t          node;                          // NUMA 节点
+    uint8_t           isBindThread;                  // 已调用 Inter.BindThread
+    uint32_t          rand_seed;                     // 窃取随机种子
+    uint64_t          period_time;                   // 上次周期事件时间 us
+    uint64_t          now;                           // 本轮调度时间 us(GetCoarseMicrosecond)
+    CO_APP_CS         cs;                            // 临界区
+#if COROUTINE_WAKE_INBOX
+    CO_ATOMIC_PTR(CO_InboxNode *) inbox_tail;   // 收件箱放入位置(多生产者交换)
+    CO_InboxNode *                inbox_head;   // 收件箱取出位置(只由本控制器访问)
+    CO_InboxNode                  inbox_stub;   // 收件箱哨兵
+#endif
 
     CM_NodeLink_t link;   // _CO_Thread
 };
@@ -267,14 +494,60 @@ struct _CO_Channel
     CO_APP_CS         cs;          // 临界区
 };
 
-static Coroutine_Inter Inter;   // 外部接口
+/**
+ * @brief    任务缓存(同一栈大小)
+ * @date     2026-10-17
+ */
+typedef struct
+{
+    uint32_t          stack_size;   // 申请栈长度 0：未使用
+    uint32_t          count;        // 缓存数量
+    CM_NodeLinkList_t tasks;        // 已结束任务 CO_TCB.run_link
+} TaskPool;
+
+#if COROUTINE_SLEEP_WHEEL
+/**
+ * @brief    分层时间轮(休眠列表)
+ * @note     第 n 层一个槽位跨 2^(WHEEL_BITS*n) 个刻度，槽位开始时下放到低层，第 0 层槽位到期
+ * @date     2026-10-17
+ */
+typedef struct
+{
+    uint64_t          tick;                                // 已处理到的刻度
+    uint32_t          count;                               // 任务数量
+    uint64_t          bitmap[WHEEL_LEVELS];                // 非空槽位图
+    CM_NodeLinkList_t slots[WHEEL_LEVELS][WHEEL_SLOTS];    // 槽位 CO_TCB.sleep_link
+    CM_NodeLinkList_t overflow;                            // 超出范围的任务，最高层进位时重新放入
+} SleepWheel;
+#endif
+
+#if COROUTINE_THREAD_LOCAL
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#define CO_THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+#define CO_THREAD_LOCAL __declspec(thread)
+#else
+#define CO_THREAD_LOCAL __thread
+#endif
+static CO_THREAD_LOCAL CO_Thread *tls_thread = NULL;   // 当前线程绑定的控制器
+#if COROUTINE_MULTI_INSTANCE
+static CO_THREAD_LOCAL struct _CO_Sched *tls_sched = NULL;   // tls_thread 所属的调度实例
+#endif
+#endif
 
-static struct
+/**
+ * @brief    调度实例(全部调度状态)
+ * @date     2026-10-17
+ */
+struct _CO_Sched
 {
+    Coroutine_Inter   inter;                 // 外部接口
     CM_NodeLinkList_t threads;               // 协程控制器列表
     CM_NodeLinkList_t semaphores;            // 信号列表
     CM_NodeLinkList_t mailboxes;             // 邮箱列表
     CM_NodeLinkList_t mutexes;               // 互斥列表 _CO_Mutex
+    CM_NodeLinkList_t rwlocks;               // 读写锁列表 _CO_RWLock(cs_mutexes)
+    CM_NodeLinkList_t event_groups;          // 事件组列表 _CO_EventGroup(cs_mutexes)
     CM_NodeLinkList_t task_list;             // 任务列表
     CM_NodeLinkList_t channels;              // 管道列表
     CO_Thread **      coroutines;            // 协程控制器
@@ -282,20 +555,47 @@ static struct
     volatile CO_TCB * idx_watchdog;          // 当前看门狗
     uint64_t          check_watchdog_time;   // 看门狗检查时间
     uint32_t          def_stack_size;        // 默认栈大小
-    uint16_t          ThreadAllocNum;        // 线程分配数量
+    volatile uint16_t ThreadAllocNum;        // 线程分配数量(已绑定线程的控制器 [0, ThreadAllocNum))
+    uint16_t          ThreadOpenNum;         // 可绑定线程的控制器数量(初始启用 + AddController 新增)
+    uint16_t          ThreadInitNum;         // 初始启用的控制器数量
+    volatile uint16_t ActiveNum;             // 启用的控制器数量
+    uint16_t          delay_co_id;           // 无任务时延迟休眠再次检查的控制器，0xFFFF：无
+    uint16_t          node_count;            // NUMA 节点数量
     volatile uint16_t SleepNum;              // 休眠数量
+#if COROUTINE_SLEEP_WHEEL
+    SleepWheel        sleep_wheel;           // 睡眠任务时间轮 CO_TCB
+#else
     CM_RBTree_t       tasks_sleep;           // 睡眠任务列表 CO_TCB
     volatile CO_TCB * idx_sleep;             // 当前休眠任务
-    CO_TaskRunList *  run_list;              // 运行列表
+#endif
+    CO_ATOMIC_U64     sleep_deadline;        // 最早休眠到期时间 us，UINT64_MAX：无
+    CO_ATOMIC_INT     timer_busy;            // 正在处理到期任务
+    uint8_t           placement;             // 默认任务分配策略 Coroutine_Placement_t
+    CO_ATOMIC_U32     place_rr;              // 轮询分配位置
+    CO_ATOMIC_U32     place_seed;            // 随机分配种子
+    CO_TaskRunList *  run_list;              // 无锁就绪队列 [thread_count][MAX_PRIORITY_NUM]
+    CO_ATOMIC_U32     ready_threads[MAX_PRIORITY_NUM];   // 各优先级有就绪任务的控制器数量(就绪位图置位/清除时增减)
+#if COROUTINE_TASK_POOL_SIZE
+    TaskPool task_pool[TASK_POOL_CLASS];   // 任务缓存(按栈大小分类)
+#endif
 
     CO_APP_CS cs_task_list;    // 任务列表临界区
     CO_APP_CS cs_sleep;        // 睡眠任务列表
     CO_APP_CS cs_semaphores;   // 临界区
     CO_APP_CS cs_mailboxes;    // 临界区
-    CO_APP_CS cs_mutexes;      // 临界区
+    CO_APP_CS cs_mutexes;      // 临界区(互斥、读写锁列表)
     CO_APP_CS cs_watchdogs;    // 临界区
-    CO_APP_CS cs_get_time;     // 临界区
-} C_Static;
+    CO_APP_CS cs_task_pool;    // 任务缓存临界区
+};
+
+#if COROUTINE_MULTI_INSTANCE
+static struct _CO_Sched                   co_default;                 // 默认调度实例
+static CO_THREAD_LOCAL struct _CO_Sched *co_sched = &co_default;   // 当前线程选择的调度实例
+#define C_Static (*co_sched)
+#else
+static struct _CO_Sched C_Static;
+#endif
+#define Inter (C_Static.inter)
 
 #define CO_EnterCriticalSection() Inter.EnterCriticalSection(__FILE__, __LINE__)
 #define CO_LeaveCriticalSection() Inter.LeaveCriticalSection(__FILE__, __LINE__)
@@ -308,8 +608,33 @@ static struct
 #define CO_APP_LeaveCriticalSection()
 #endif
 
+// 自旋等待提示(降低功耗，让出超线程流水线)
+#if defined(__i386__) || defined(__x86_64__)
+#define CO_CPU_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+#define CO_CPU_RELAX() __asm__ __volatile__("yield" ::: "memory")
+#else
+#define CO_CPU_RELAX() __asm__ __volatile__("" ::: "memory")
+#endif
+#define CO_CS_BACKOFF_MAX 1024   // 最大退避自旋次数
+
+#if COROUTINE_CS_STATS
+#define CO_CS_STATS(cs, n)          \
+    do {                            \
+        (cs)->acquire++;            \
+        if (n) {                    \
+            (cs)->contend++;        \
+            (cs)->spin += (n);      \
+        }                           \
+    } while (0)
+#else
+#define CO_CS_STATS(cs, n) (void)(n)
+#endif
+
 /**
  * @brief    进入临界区(非内核，不可重入)
+ * @note     ticket：取号后等待叫号，退避次数与前方排队数成正比；
+ *           TTAS：先只读等待空闲再 CAS，失败后指数退避
  * @param    cs             
  * @author   CXS (chenxiangshu@outlook.com)
  * @date     2024-07-12
@@ -318,17 +643,48 @@ static struct
 static inline void CO_APP_ENTER(CO_APP_CS cs)
 {
     size_t n = 0;
-    while (!__sync_bool_compare_and_swap(cs, 0, 1)) {
+#if COROUTINE_CS_TICKET
+    unsigned int ticket = atomic_fetch_add_explicit(&cs->next, 1, memory_order_relaxed);
+    while (true) {
+        unsigned int d = ticket - atomic_load_explicit(&cs->owner, memory_order_acquire);
+        if (d == 0)
+            break;
+        // 自旋等待
+        for (unsigned int i = d < CO_CS_BACKOFF_MAX / 16 ? d * 16 : CO_CS_BACKOFF_MAX; i; i--)
+            CO_CPU_RELAX();
+        n++;
+    }
+#else
+    unsigned int backoff = 1;
+    while (atomic_load_explicit(&cs->lock, memory_order_relaxed) ||
+           atomic_exchange_explicit(&cs->lock, 1, memory_order_acquire)) {
         // 自旋等待
+        for (unsigned int i = backoff; i; i--)
+            CO_CPU_RELAX();
+        if (backoff < CO_CS_BACKOFF_MAX)
+            backoff <<= 1;
         n++;
     }
-    (void)n;
+#endif
+    CO_CS_STATS(cs, n);
     return;
 }
 
 static inline bool CO_APP_TRY_ENTER(CO_APP_CS cs)
 {
-    return __sync_bool_compare_and_swap(cs, 0, 1);
+#if COROUTINE_CS_TICKET
+    unsigned int owner = atomic_load_explicit(&cs->owner, memory_order_relaxed);
+    if (atomic_load_explicit(&cs->next, memory_order_relaxed) != owner)
+        return false;
+    if (!atomic_compare_exchange_strong_explicit(&cs->next, &owner, owner + 1, memory_order_acquire, memory_order_relaxed))
+        return false;
+#else
+    if (atomic_load_explicit(&cs->lock, memory_order_relaxed) ||
+        atomic_exchange_explicit(&cs->lock, 1, memory_order_acquire))
+        return false;
+#endif
+    CO_CS_STATS(cs, 0);
+    return true;
 }
 #else
 #define CO_APP_ENTER(cs) CO_EnterCriticalSection()
@@ -336,6 +692,7 @@ static inline bool CO_APP_TRY_ENTER(CO_APP_CS cs)
 
 /**
  * @brief    离开临界区(不可重入)
+ * @note     只需 release 存储，无需全屏障
  * @param    cs             
  * @author   CXS (chenxiangshu@outlook.com)
  * @date     2024-07-12
@@ -343,14 +700,192 @@ static inline bool CO_APP_TRY_ENTER(CO_APP_CS cs)
 #if COROUTINE_BLOCK_CRITICAL_SECTION
 static inline void CO_APP_LEAVE(CO_APP_CS cs)
 {
-    __sync_and_and_fetch(cs, 0);
+#if COROUTINE_CS_TICKET
+    // 只有持有者修改 owner
+    atomic_store_explicit(&cs->owner, atomic_load_explicit(&cs->owner, memory_order_relaxed) + 1, memory_order_release);
+#else
+    atomic_store_explicit(&cs->lock, 0, memory_order_release);
+#endif
 }
 #else
 #define CO_APP_LEAVE(cs) CO_LeaveCriticalSection()
 #endif
 
+// 原子操作 (CO_ATOMIC_ADD/SUB/OR/AND 返回旧值，整数宽度 4 或 8 字节，指针使用 *_PTR)
+#if COROUTINE_BLOCK_CRITICAL_SECTION
+#define CO_ATOMIC_LOAD(p)          atomic_load_explicit(p, memory_order_acquire)
+#define CO_ATOMIC_LOAD_RELAXED(p)  atomic_load_explicit(p, memory_order_relaxed)
+#define CO_ATOMIC_STORE(p, v)      atomic_store_explicit(p, v, memory_order_release)
+#define CO_ATOMIC_CAS(p, e, v)     atomic_compare_exchange_strong_explicit(p, e, v, memory_order_acq_rel, memory_order_acquire)
+#define CO_ATOMIC_ADD(p, v)        atomic_fetch_add_explicit(p, v, memory_order_acq_rel)
+#define CO_ATOMIC_SUB(p, v)        atomic_fetch_sub_explicit(p, v, memory_order_acq_rel)
+#define CO_ATOMIC_XCHG(p, v)       atomic_exchange_explicit(p, v, memory_order_acq_rel)
+#define CO_ATOMIC_OR(p, v)         atomic_fetch_or_explicit(p, v, memory_order_acq_rel)
+#define CO_ATOMIC_AND(p, v)        atomic_fetch_and_explicit(p, v, memory_order_acq_rel)
+#define CO_ATOMIC_FENCE()          atomic_thread_fence(memory_order_seq_cst)
+#define CO_ATOMIC_CAS_PTR(p, e, v) CO_ATOMIC_CAS(p, e, v)
+#define CO_ATOMIC_XCHG_PTR(p, v)   CO_ATOMIC_XCHG(p, v)
+#else
+// 不支持 C11 原子时用全局临界区实现，按宽度(4/8 字节)选择函数；指针使用 CO_ATOMIC_CAS_PTR/CO_ATOMIC_XCHG_PTR
+static inline bool _CS_Cas32(volatile uint32_t *p, uint32_t *e, uint32_t v)
+{
+    CO_EnterCriticalSection();
+    bool isOk = *p == *e;
+    if (isOk)
+        *p = v;
+    else
+        *e = *p;
+    CO_LeaveCriticalSection();
+    return isOk;
+}
+static inline uint32_t _CS_Add32(volatile uint32_t *p, uint32_t v)
+{
+    CO_EnterCriticalSection();
+    uint32_t old = *p;
+    *p = old + v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint32_t _CS_Sub32(volatile uint32_t *p, uint32_t v)
+{
+    CO_EnterCriticalSection();
+    uint32_t old = *p;
+    *p = old - v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint32_t _CS_Xchg32(volatile uint32_t *p, uint32_t v)
+{
+    CO_EnterCriticalSection();
+    uint32_t old = *p;
+    *p = v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint32_t _CS_Or32(volatile uint32_t *p, uint32_t v)
+{
+    CO_EnterCriticalSection();
+    uint32_t old = *p;
+    *p = old | v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint32_t _CS_And32(volatile uint32_t *p, uint32_t v)
+{
+    CO_EnterCriticalSection();
+    uint32_t old = *p;
+    *p = old & v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline bool _CS_Cas64(volatile uint64_t *p, uint64_t *e, uint64_t v)
+{
+    CO_EnterCriticalSection();
+    bool isOk = *p == *e;
+    if (isOk)
+        *p = v;
+    else
+        *e = *p;
+    CO_LeaveCriticalSection();
+    return isOk;
+}
+static inline uint64_t _CS_Add64(volatile uint64_t *p, uint64_t v)
+{
+    CO_EnterCriticalSection();
+    uint64_t old = *p;
+    *p = old + v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint64_t _CS_Sub64(volatile uint64_t *p, uint64_t v)
+{
+    CO_EnterCriticalSection();
+    uint64_t old = *p;
+    *p = old - v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint64_t _CS_Xchg64(volatile uint64_t *p, uint64_t v)
+{
+    CO_EnterCriticalSection();
+    uint64_t old = *p;
+    *p = v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint64_t _CS_Or64(volatile uint64_t *p, uint64_t v)
+{
+    CO_EnterCriticalSection();
+    uint64_t old = *p;
+    *p = old | v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline uint64_t _CS_And64(volatile uint64_t *p, uint64_t v)
+{
+    CO_EnterCriticalSection();
+    uint64_t old = *p;
+    *p = old & v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline bool _CS_CasPtr(void *volatile *p, void **e, void *v)
+{
+    CO_EnterCriticalSection();
+    bool isOk = *p == *e;
+    if (isOk)
+        *p = v;
+    else
+        *e = *p;
+    CO_LeaveCriticalSection();
+    return isOk;
+}
+static inline void *_CS_XchgPtr(void *volatile *p, void *v)
+{
+    CO_EnterCriticalSection();
+    void *old = *p;
+    *p        = v;
+    CO_LeaveCriticalSection();
+    return old;
+}
+static inline void _CS_Fence(void)
+{
+#if defined(__GNUC__)
+    __sync_synchronize();
+#else
+    // 进出临界区即完整内存屏障
+    CO_EnterCriticalSection();
+    CO_LeaveCriticalSection();
+#endif
+}
+#define _CS_OP(op, p, v) \
+    (sizeof(*(p)) == 8 ? _CS_##op##64((volatile uint64_t *)(p), (uint64_t)(v)) : _CS_##op##32((volatile uint32_t *)(p), (uint32_t)(v)))
+#define CO_ATOMIC_LOAD(p)          (*(p))
+#define CO_ATOMIC_LOAD_RELAXED(p)  (*(p))
+#define CO_ATOMIC_STORE(p, v)      (*(p) = (v))
+#define CO_ATOMIC_CAS(p, e, v)                                                                \
+    (sizeof(*(p)) == 8 ? _CS_Cas64((volatile uint64_t *)(p), (uint64_t *)(e), (uint64_t)(v)) \
+                       : _CS_Cas32((volatile uint32_t *)(p), (uint32_t *)(e), (uint32_t)(v)))
+#define CO_ATOMIC_ADD(p, v)        _CS_OP(Add, p, v)
+#define CO_ATOMIC_SUB(p, v)        _CS_OP(Sub, p, v)
+#define CO_ATOMIC_XCHG(p, v)       _CS_OP(Xchg, p, v)
+#define CO_ATOMIC_OR(p, v)         _CS_OP(Or, p, v)
+#define CO_ATOMIC_AND(p, v)        _CS_OP(And, p, v)
+#define CO_ATOMIC_CAS_PTR(p, e, v) _CS_CasPtr((void *volatile *)(p), (void **)(e), (void *)(v))
+#define CO_ATOMIC_XCHG_PTR(p, v)   _CS_XchgPtr((void *volatile *)(p), (void *)(v))
+#define CO_ATOMIC_FENCE()          _CS_Fence()
+#endif
+
 // 设置任务执行时间
-#define CO_SET_TASK_TIME(task, t) (task)->execv_time = (t) ? (t) + GetMillisecond() : 0;
+#define CO_SET_TASK_TIME(task, t) (task)->execv_time = (t) ? (t) + GetMicrosecond() : 0;   // t：us
+#define CO_MS_TO_US(ms)           ((uint64_t)(ms) * 1000)
+
+// 记录任务迁移(更换控制器)
+#if COROUTINE_ENABLE_PRINT_INFO
+#define CO_TASK_MIGRATED(task) (task)->migrations++
+#else
+#define CO_TASK_MIGRATED(task)
+#endif
 
 #if COROUTINE_ENABLE_SEMAPHORE
 static void DeleteMessage(Coroutine_MailData *dat);
@@ -358,8 +893,14 @@ static void DeleteMessage(Coroutine_MailData *dat);
 static Coroutine_Handle Coroutine_Create(size_t);
 static CO_Thread *      _GetCurrentThread(int, bool);
 static void             Coroutine_Register_Task_Run(void);
+static void             _Destroy_Task(CO_TCB *t);
 static void             AddTaskList(CO_TCB *task, uint64_t now);
 static uint64_t         GetMillisecond(void);
+static uint64_t         GetMicrosecond(void);
+static uint64_t         GetCoarseMicrosecond(void);
+#if COROUTINE_ENABLE_RWLOCK
+static int32_t _RWLock_Readers(CO_RWLock *rw);
+#endif
 
 #define _ERROR_IDLE                                               \
     while (true) {                                                \
@@ -423,10 +964,36 @@ static uint64_t         GetMillisecond(void);
         _ERROR_CALL(CO_ERR_MUTEX_DELETE, pars); \
     } while (false)
 
-// 检查栈哨兵
-#define CHECK_STACK_SENTRY(n)                                                                    \
-    if (n->stack[0] != STACK_SENTRY_END || n->stack[n->stack_alloc - 1] != STACK_SENTRY_START) { \
-        ERROR_STACK(n, 0);                                                                       \
+// CO_ERR_RWLOCK_RELIEVE
+#define ERROR_RWLOCK_RELIEVE(task, _rw)                      \
+    do {                                                     \
+        Coroutine_ErrPars_t pars;                            \
+        pars.rwlock_relieve.taskId = (Coroutine_TaskId)task; \
+        pars.rwlock_relieve.rwlock = _rw;                    \
+        _ERROR_CALL(CO_ERR_RWLOCK_RELIEVE, pars);            \
+    } while (false)
+
+// CO_ERR_RWLOCK_DELETE
+#define ERROR_RWLOCK_DELETE(_rw)                 \
+    do {                                         \
+        Coroutine_ErrPars_t pars;                \
+        pars.rwlock_delete.rwlock = _rw;         \
+        _ERROR_CALL(CO_ERR_RWLOCK_DELETE, pars); \
+    } while (false)
+
+// CO_ERR_EVENT_DELETE
+#define ERROR_EVENT_DELETE(_group)              \
+    do {                                        \
+        Coroutine_ErrPars_t pars;               \
+        pars.event_delete.group = _group;       \
+        _ERROR_CALL(CO_ERR_EVENT_DELETE, pars); \
+    } while (false)
+
+// 检查栈哨兵(接口分配的栈由保护页检查溢出，不访问栈底避免提交内存)
+#define CHECK_STACK_SENTRY(n)                                                         \
+    if ((!n->isStackInter && n->stack[0] != STACK_SENTRY_END) ||                      \
+        n->stack[n->stack_alloc - 1] != STACK_SENTRY_START) {                         \
+        ERROR_STACK(n, 0);                                                            \
     }
 
 // --------------------------------------------------------------------------------------
@@ -444,6 +1011,14 @@ static void CheckStack(volatile CO_TCB *t)
 {
     uint32_t *p = (uint32_t *)t->stack;
     CHECK_STACK_SENTRY(t);
+    if (t->isStackInter) {
+        // 未填充栈，由接口统计已使用(已提交)的栈大小
+        if (Inter.StackUsage == NULL)
+            return;
+        uint32_t s = Inter.StackUsage(t->stack, t->stack_alloc * sizeof(STACK_TYPE)) / sizeof(STACK_TYPE);
+        if (s > t->stack_max) t->stack_max = s;
+        return;
+    }
     uint32_t idx = 1;
     for (; idx < t->stack_alloc - 1; idx++) {
         if (p[idx] != 0xEEEEEEEE)
@@ -467,7 +1042,8 @@ static void CheckStack(volatile CO_TCB *t)
  */
 static bool CheckAndWakeIdleThread(CO_Thread *c)
 {
-    int wakes    = 0;
+    int wakes = 0;
+    CO_ATOMIC_FENCE();   // 与 _Task 停放前的检查配对，避免丢失唤醒
     int SleepNum = C_Static.SleepNum;
     if (c->run_count == c->wake_count)
         return false;
@@ -482,77 +1058,434 @@ static bool CheckAndWakeIdleThread(CO_Thread *c)
     }
     c->wake_count += wakes;
     CO_APP_LEAVE(c->cs);
+    if (Inter.events->park != NULL && Inter.events->unpark != NULL) {
+        // 优先唤醒任务所在的控制器(已退役时由其转移任务)，其余唤醒启用的空闲控制器窃取
+        for (size_t i = 0, k = c->co_id; i < Inter.thread_count && wakes > 0; i++, k = (k + 1) % Inter.thread_count) {
+            CO_Thread *t      = C_Static.coroutines[k];
+            int        parked = 1;
+            if (t != c && CO_ATOMIC_LOAD_RELAXED(&t->isRetired))
+                continue;
+            if (CO_ATOMIC_CAS(&t->isParked, &parked, 0)) {
+                Inter.events->unpark(t->co_id, Inter.events->object);
+                wakes--;
+            }
+        }
+        if (wakes > 0) {
+            // 空闲控制器还未停放(停放前会重新检查就绪任务)，退还没有用到的唤醒登记
+            size_t count = CO_ATOMIC_LOAD_RELAXED(&c->wake_count);
+            while (!CO_ATOMIC_CAS(&c->wake_count, &count, count > (size_t)wakes ? count - wakes : 0))
+                ;
+            isOk = true;
+        }
+        return isOk;
+    }
     for (int i = 0; i < wakes && Inter.events->wake; i++)
         Inter.events->wake(Inter.events->object);
     return isOk;
 }
 
+#if COROUTINE_TASK_POOL_SIZE
 /**
- * @brief    删除任务
- * @param    inter
- * @param    t
- * @author   CXS (chenxiangshu@outlook.com)
- * @date     2022-08-17
+ * @brief    查找任务缓存分类 【需要CO_APP_ENTER(C_Static.cs_task_pool)】
+ * @param    stack_size     申请栈长度
+ * @param    isNew          没有时使用空分类
+ * @return   TaskPool*      NULL：没有
+ * @date     2026-10-17
  */
-static void DeleteTask(CO_TCB *t)
+static TaskPool *_Find_TaskPool(uint32_t stack_size, bool isNew)
 {
-    // 移除看门狗
-    if (t->watchdog && t->watchdog->expiration_time) {
-        CO_EnterCriticalSection();
-        CM_RBTree_Remove(&C_Static.watchdogs, &t->watchdog->link);
-        if (C_Static.idx_watchdog == t) {
-            WatchdogNode *n       = CM_Field_ToType(WatchdogNode, link, CM_RBTree_LeftEnd(&C_Static.watchdogs));
-            C_Static.idx_watchdog = n == NULL ? NULL : n->task;
-        }
-        CO_LeaveCriticalSection();
+    for (int i = 0; i < TASK_POOL_CLASS; i++) {
+        if (C_Static.task_pool[i].stack_size == stack_size)
+            return &C_Static.task_pool[i];
     }
-    if (t->watchdog) Inter.Free(t->watchdog, __FILE__, __LINE__);
-    // 移除任务列表
-    CO_APP_ENTER(C_Static.cs_task_list);
-    CM_NodeLink_Remove(&C_Static.task_list, &t->task_list_link);
-    CO_APP_LEAVE(C_Static.cs_task_list);
-    // 释放名称
-    if (t->name) Inter.Free(t->name, __FILE__, __LINE__);
-    // 释放堆栈
-    Inter.Free(t->stack, __FILE__, __LINE__);
-    // 释放实例
-    Inter.Free(t, __FILE__, __LINE__);
-    return;
+    for (int i = 0; i < TASK_POOL_CLASS && isNew; i++) {
+        if (C_Static.task_pool[i].count == 0)
+            return &C_Static.task_pool[i];
+    }
+    return NULL;
 }
+#endif
 
-static CO_TCB *_Del_SleepList(CO_TCB *task)
+/**
+ * @brief    将任务栈绑定到控制器所在的 NUMA 节点(单节点时不处理)
+ * @param    n
+ * @param    node           NUMA 节点
+ * @date     2026-10-17
+ */
+static void _Bind_TaskNode(CO_TCB *n, uint16_t node)
 {
-    if (task->isAddSleepList) {
-        // 从休眠树中移除
-        CM_RBTree_Remove(&C_Static.tasks_sleep, &task->sleep_link);
-        if (task == C_Static.idx_sleep) {
-            // 更新当前休眠任务
-            CM_RBTree_Link_t *link = CM_RBTree_LeftEnd(&C_Static.tasks_sleep);
-            C_Static.idx_sleep     = link == NULL ? NULL : CM_Field_ToType(CO_TCB, sleep_link, link);
-        }
-        task->isAddSleepList = 0;
-    } else
-        task = NULL;
-    return task;
+    if (C_Static.node_count <= 1 || Inter.BindMemory == NULL || n->stack_node == node)
+        return;
+    Inter.BindMemory(n->stack, n->stack_alloc * sizeof(STACK_TYPE), node);
+    n->stack_node = node;
+    return;
 }
 
-static CO_TCB *_Del_RunList(CO_TCB *task)
+/**
+ * @brief    分配任务实例和栈，优先使用任务缓存
+ * @param    stack_size     栈长度
+ * @param    node           运行控制器所在的 NUMA 节点
+ * @return   CO_TCB*
+ * @date     2026-10-17
+ */
+static CO_TCB *_Alloc_Task(uint32_t stack_size, uint16_t node)
 {
-    if (task->isAddRunList) {
-        CO_Thread *c = task->coroutine;
-        if (c->run_count == 0) {
-            c->run_count++;   // Debug
-            c->run_count--;
+    CO_TCB *n = NULL;
+#if COROUTINE_TASK_POOL_SIZE
+    CO_APP_ENTER(C_Static.cs_task_pool);
+    TaskPool *pool = _Find_TaskPool(stack_size, false);
+    if (pool != NULL && pool->count) {
+        // 后进先出，栈仍在缓存中；多个 NUMA 节点时优先取同节点的
+        n = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_End(pool->tasks));
+        if (C_Static.node_count > 1 && n->stack_node != node) {
+            CM_NodeLink_Foreach_Positive(CO_TCB, run_link, pool->tasks, t)
+            {
+                if (t->stack_node == node) {
+                    n = t;
+                    break;
+                }
+            }
         }
-        CM_NodeLink_Remove(&c->run_tasks, &task->run_link);
-        task->isAddRunList = 0;
-        c->run_count--;
-        if (c->wake_count) c->wake_count--;
+        CM_NodeLink_Remove(&pool->tasks, &n->run_link);
+        pool->count--;
+    }
+    CO_APP_LEAVE(C_Static.cs_task_pool);
+    if (n != NULL) {
+        // 保留栈和看门狗节点，其余清零
+        STACK_TYPE *  stack        = n->stack;
+        uint32_t      stack_alloc  = n->stack_alloc;
+        uint32_t      stack_max    = n->stack_max;
+        uint16_t      stack_node   = n->stack_node;
+        bool          isStackInter = n->isStackInter;
+        WatchdogNode *watchdog     = n->watchdog;
+        CM_ZERO(n);
+        n->stack        = stack;
+        n->stack_alloc  = stack_alloc;
+        n->stack_size   = stack_size;
+        n->stack_node   = stack_node;
+        n->isStackInter = isStackInter;
+        n->watchdog     = watchdog;
+        _Bind_TaskNode(n, node);
+#if COROUTINE_CHECK_STACK || COROUTINE_ENABLE_PRINT_INFO
+        // 只重新填充上次使用过的栈空间
+        if (!isStackInter) {
+            uint32_t len = stack_max + 16 < stack_alloc ? stack_max + 16 : stack_alloc;
+            memset(stack + stack_alloc - len, 0xEE, len * sizeof(STACK_TYPE));
+        }
+#else
+        (void)stack_max;
+#endif
+        return n;
+    }
+#endif
+    n = (CO_TCB *)Inter.Malloc(sizeof(CO_TCB), __FILE__, __LINE__);
+    if (n == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, sizeof(CO_TCB));
+    CM_ZERO(n);
+    n->stack_size = stack_size;
+    if (Inter.AllocStack != NULL && Inter.FreeStack != NULL) {
+        size_t size     = stack_size * sizeof(STACK_TYPE);
+        n->stack        = (STACK_TYPE *)Inter.AllocStack(&size);
+        n->stack_alloc  = size / sizeof(STACK_TYPE);
+        n->isStackInter = n->stack != NULL;
+    }
+    if (n->stack == NULL) {
+        n->stack       = (STACK_TYPE *)Inter.Malloc(stack_size * sizeof(STACK_TYPE), __FILE__, __LINE__);   // 预分配 512 字节
+        n->stack_alloc = stack_size;
+    }
+    if (n->stack == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, stack_size * sizeof(STACK_TYPE));
+    n->stack_node = 0xFFFF;
+    _Bind_TaskNode(n, node);
+#if COROUTINE_CHECK_STACK || COROUTINE_ENABLE_PRINT_INFO
+    // 初始化栈空间(接口分配的栈按需提交，不填充)
+    if (!n->isStackInter)
+        memset(n->stack, 0xEE, n->stack_alloc * sizeof(STACK_TYPE));
+#endif
+    return n;
+}
+
+/**
+ * @brief    释放任务实例和栈，放入任务缓存
+ * @param    t
+ * @date     2026-10-17
+ */
+static void _Free_Task(CO_TCB *t)
+{
+#if COROUTINE_TASK_POOL_SIZE
+#if COROUTINE_CHECK_STACK || COROUTINE_ENABLE_PRINT_INFO
+    if (!t->isStackInter)
+        CheckStack(t);   // 统计使用过的栈空间，重新使用时只填充这部分
+#endif
+    CO_APP_ENTER(C_Static.cs_task_pool);
+    TaskPool *pool = _Find_TaskPool(t->stack_size, true);
+    if (pool != NULL && pool->count < COROUTINE_TASK_POOL_SIZE) {
+        pool->stack_size = t->stack_size;
+        CM_NodeLink_Insert(&pool->tasks, CM_NodeLink_End(pool->tasks), &t->run_link);
+        pool->count++;
+        t = NULL;
+    }
+    CO_APP_LEAVE(C_Static.cs_task_pool);
+    if (t == NULL)
+        return;
+#endif
+    _Destroy_Task(t);
+    return;
+}
+
+/**
+ * @brief    释放任务内存(看门狗、栈、实例)
+ * @param    t
+ * @date     2026-10-17
+ */
+static void _Destroy_Task(CO_TCB *t)
+{
+    // 释放看门狗
+    if (t->watchdog) Inter.Free(t->watchdog, __FILE__, __LINE__);
+    // 释放堆栈
+    if (t->isStackInter)
+        Inter.FreeStack(t->stack, t->stack_alloc * sizeof(STACK_TYPE));
+    else
+        Inter.Free(t->stack, __FILE__, __LINE__);
+    // 释放实例
+    Inter.Free(t, __FILE__, __LINE__);
+    return;
+}
+
+/**
+ * @brief    释放任务实例引用，最后一个引用释放内存
+ * @param    t
+ * @date     2026-10-17
+ */
+static void _Release_Task(CO_TCB *t)
+{
+    if (CO_ATOMIC_SUB(&t->refs, 1) == 1)
+        _Free_Task(t);
+    return;
+}
+
+/**
+ * @brief    删除任务
+ * @param    inter
+ * @param    t
+ * @author   CXS (chenxiangshu@outlook.com)
+ * @date     2022-08-17
+ */
+static void DeleteTask(CO_TCB *t)
+{
+    // 移除看门狗
+    if (t->watchdog && t->watchdog->expiration_time) {
+        CO_EnterCriticalSection();
+        CM_RBTree_Remove(&C_Static.watchdogs, &t->watchdog->link);
+        if (C_Static.idx_watchdog == t) {
+            WatchdogNode *n       = CM_Field_ToType(WatchdogNode, link, CM_RBTree_LeftEnd(&C_Static.watchdogs));
+            C_Static.idx_watchdog = n == NULL ? NULL : n->task;
+        }
+        t->watchdog->expiration_time = 0;
+        CO_LeaveCriticalSection();
+    }
+    // 移除任务列表
+    CO_APP_ENTER(C_Static.cs_task_list);
+    CM_NodeLink_Remove(&C_Static.task_list, &t->task_list_link);
+    CO_APP_LEAVE(C_Static.cs_task_list);
+    // 释放实例、栈和看门狗(就绪队列中可能还有过期引用，放入任务缓存)
+    _Release_Task(t);
+    return;
+}
+
+#if COROUTINE_SLEEP_WHEEL
+/**
+ * @brief    放入时间轮 【需要CO_APP_ENTER(C_Static.cs_sleep)】
+ * @param    task
+ * @param    min_tick       最早到期刻度
+ * @date     2026-10-17
+ */
+static void _Wheel_Insert(CO_TCB *task, uint64_t min_tick)
+{
+    SleepWheel *        w     = &C_Static.sleep_wheel;
+    uint64_t            tick  = (task->execv_time + WHEEL_TICK - 1) >> COROUTINE_SLEEP_WHEEL_SHIFT;   // 向上取整，不提前唤醒
+    CM_NodeLinkList_t * list  = &w->overflow;
+    int                 level = 0;
+    if (tick < min_tick) tick = min_tick;
+    uint64_t delta = tick - w->tick;
+    while (level < WHEEL_LEVELS && delta >= (1ULL << (WHEEL_BITS * (level + 1))))
+        level++;
+    if (level < WHEEL_LEVELS) {
+        int slot = (tick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+        list     = &w->slots[level][slot];
+        w->bitmap[level] |= 1ULL << slot;
+        task->sleep_slot = level * WHEEL_SLOTS + slot;
+    } else
+        task->sleep_slot = WHEEL_OVERFLOW;
+    CM_NodeLink_Insert(list, CM_NodeLink_End(*list), &task->sleep_link);
+    return;
+}
+
+/**
+ * @brief    从时间轮中移除 【需要CO_APP_ENTER(C_Static.cs_sleep)】
+ * @param    task
+ * @date     2026-10-17
+ */
+static void _Wheel_Remove(CO_TCB *task)
+{
+    SleepWheel *w = &C_Static.sleep_wheel;
+    if (task->sleep_slot == WHEEL_OVERFLOW) {
+        CM_NodeLink_Remove(&w->overflow, &task->sleep_link);
+        return;
+    }
+    int level = task->sleep_slot / WHEEL_SLOTS;
+    int slot  = task->sleep_slot % WHEEL_SLOTS;
+    CM_NodeLink_Remove(&w->slots[level][slot], &task->sleep_link);
+    if (CM_NodeLink_IsEmpty(w->slots[level][slot]))
+        w->bitmap[level] &= ~(1ULL << slot);
+    return;
+}
+
+/**
+ * @brief    下一个需要处理的刻度(槽位到期或下放) 【需要CO_APP_ENTER(C_Static.cs_sleep)】
+ * @return   uint64_t       UINT64_MAX：时间轮为空
+ * @date     2026-10-17
+ */
+static uint64_t _Wheel_NextTick(void)
+{
+    SleepWheel *w    = &C_Static.sleep_wheel;
+    uint64_t    next = UINT64_MAX;
+    for (int level = 0; level < WHEEL_LEVELS; level++) {
+        if (w->bitmap[level] == 0)
+            continue;
+        int      shift = WHEEL_BITS * level;
+        uint64_t base  = w->tick >> shift;
+        int      rot   = (int)((base + 1) & (WHEEL_SLOTS - 1));
+        uint64_t bm    = rot == 0 ? w->bitmap[level] : (w->bitmap[level] >> rot) | (w->bitmap[level] << (64 - rot));
+        uint64_t tick  = (base + 1 + CO_BITMAP64_FIRST(bm)) << shift;
+        if (tick < next) next = tick;
+    }
+    if (!CM_NodeLink_IsEmpty(w->overflow)) {
+        int      shift = WHEEL_BITS * WHEEL_LEVELS;
+        uint64_t tick  = ((w->tick >> shift) + 1) << shift;
+        if (tick < next) next = tick;
+    }
+    return next;
+}
+
+/**
+ * @brief    下放槽位中的任务到低层 【需要CO_APP_ENTER(C_Static.cs_sleep)】
+ * @param    list
+ * @date     2026-10-17
+ */
+static void _Wheel_Cascade(CM_NodeLinkList_t *list)
+{
+    CM_NodeLinkList_t tasks = *list;
+    *list                   = NULL;
+    while (!CM_NodeLink_IsEmpty(tasks)) {
+        CO_TCB *task = CM_Field_ToType(CO_TCB, sleep_link, CM_NodeLink_First(tasks));
+        CM_NodeLink_Remove(&tasks, &task->sleep_link);
+        _Wheel_Insert(task, C_Static.sleep_wheel.tick);
+    }
+    return;
+}
+
+/**
+ * @brief    推进时间轮，取出全部到期任务 【需要CO_APP_ENTER(C_Static.cs_sleep)】
+ * @param    now            当前时间 us
+ * @param    expired        [out]到期任务 CO_TCB.run_link
+ * @date     2026-10-17
+ */
+static void _Wheel_Advance(uint64_t now, CM_NodeLinkList_t *expired)
+{
+    SleepWheel *w      = &C_Static.sleep_wheel;
+    uint64_t    target = now >> COROUTINE_SLEEP_WHEEL_SHIFT;
+    while (w->count && w->tick < target) {
+        uint64_t tick = _Wheel_NextTick();
+        if (tick > target)
+            break;
+        w->tick = tick;
+        // 从高层到低层下放
+        if ((tick & ((1ULL << (WHEEL_BITS * WHEEL_LEVELS)) - 1)) == 0)
+            _Wheel_Cascade(&w->overflow);
+        for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+            int shift = WHEEL_BITS * level;
+            if (tick & ((1ULL << shift) - 1))
+                continue;
+            int slot = (tick >> shift) & (WHEEL_SLOTS - 1);
+            w->bitmap[level] &= ~(1ULL << slot);
+            _Wheel_Cascade(&w->slots[level][slot]);
+        }
+        // 第 0 层到期
+        int                slot = tick & (WHEEL_SLOTS - 1);
+        CM_NodeLinkList_t *list = &w->slots[0][slot];
+        while (!CM_NodeLink_IsEmpty(*list)) {
+            CO_TCB *task = CM_Field_ToType(CO_TCB, sleep_link, CM_NodeLink_First(*list));
+            CM_NodeLink_Remove(list, &task->sleep_link);
+            CM_NodeLink_Insert(expired, CM_NodeLink_End(*expired), &task->run_link);
+            task->isAddSleepList = 0;
+            w->count--;
+        }
+        w->bitmap[0] &= ~(1ULL << slot);
+    }
+    if (w->tick < target) w->tick = target;
+    return;
+}
+
+static CO_TCB *_Del_SleepList(CO_TCB *task)
+{
+    if (task->isAddSleepList) {
+        // 从时间轮中移除
+        _Wheel_Remove(task);
+        C_Static.sleep_wheel.count--;
+        task->isAddSleepList = 0;
+    } else
+        task = NULL;
+    return task;
+}
+#else
+static CO_TCB *_Del_SleepList(CO_TCB *task)
+{
+    if (task->isAddSleepList) {
+        // 从休眠树中移除
+        CM_RBTree_Remove(&C_Static.tasks_sleep, &task->sleep_link);
+        if (task == C_Static.idx_sleep) {
+            // 更新当前休眠任务
+            CM_RBTree_Link_t *link = CM_RBTree_LeftEnd(&C_Static.tasks_sleep);
+            C_Static.idx_sleep     = link == NULL ? NULL : CM_Field_ToType(CO_TCB, sleep_link, link);
+        }
+        task->isAddSleepList = 0;
     } else
         task = NULL;
     return task;
 }
 
+#endif
+
+/**
+ * @brief    认领就绪任务后减少所属控制器的运行数量
+ * @param    owner          task->coroutine
+ * @date     2026-10-17
+ */
+static inline void _Claimed_RunCount(CO_Thread *owner)
+{
+    size_t wakes = CO_ATOMIC_LOAD_RELAXED(&owner->wake_count);
+    CO_ATOMIC_SUB(&owner->run_count, 1);
+    while (wakes && !CO_ATOMIC_CAS(&owner->wake_count, &wakes, wakes - 1))
+        ;
+    return;
+}
+
+static CO_TCB *_Del_RunList(CO_TCB *task)
+{
+    CO_Thread *c = task->coroutine;
+    if (task->isAddRunList) {
+        CM_NodeLink_Remove(&c->run_tasks[task->pri], &task->run_link);
+        task->isAddRunList = 0;
+    } else {
+        // 从就绪队列中认领，队列中的项作废(保留引用直到该项被取出)
+        int queued = 1;
+        if (!CO_ATOMIC_CAS(&task->queued, &queued, 0))
+            return NULL;
+        CO_ATOMIC_ADD(&task->refs, 1);
+    }
+    _Claimed_RunCount(c);
+    return task;
+}
+
 static CO_TCB *DelTaskList(CO_TCB *task)
 {
     CO_TCB *t = NULL;
@@ -566,25 +1499,74 @@ static CO_TCB *DelTaskList(CO_TCB *task)
     return t;
 }
 
+/**
+ * @brief    更新最早休眠到期时间 【需要CO_APP_ENTER(C_Static.cs_sleep)】
+ * @date     2026-10-17
+ */
+static void _Update_SleepDeadline(void)
+{
+    uint64_t deadline = UINT64_MAX;
+#if COROUTINE_SLEEP_WHEEL
+    uint64_t tick = _Wheel_NextTick();
+    if (tick != UINT64_MAX)
+        deadline = tick << COROUTINE_SLEEP_WHEEL_SHIFT;
+#else
+    if (C_Static.idx_sleep)
+        deadline = C_Static.idx_sleep->execv_time;
+#endif
+    CO_ATOMIC_STORE(&C_Static.sleep_deadline, deadline);
+    return;
+}
+
 static void _Add_SleepList(CO_TCB *task)
 {
     CO_APP_ENTER(C_Static.cs_sleep);
     // 加入休眠列表
     task->isAddSleepList = 1;
+#if COROUTINE_SLEEP_WHEEL
+    if (C_Static.sleep_wheel.count++ == 0)
+        C_Static.sleep_wheel.tick = GetMicrosecond() >> COROUTINE_SLEEP_WHEEL_SHIFT;   // 空闲期间不推进，直接对齐
+    _Wheel_Insert(task, C_Static.sleep_wheel.tick + 1);
+#else
     CM_RBTree_Insert(&C_Static.tasks_sleep, &task->sleep_link);
     if (C_Static.idx_sleep == NULL || C_Static.idx_sleep->execv_time > task->execv_time)
         C_Static.idx_sleep = task;   // 当前休眠任务设置为最早的任务
+#endif
+    _Update_SleepDeadline();
     CO_APP_LEAVE(C_Static.cs_sleep);
     return;
 }
 
+/**
+ * @brief    加入就绪队列 【需要CO_APP_ENTER(task->coroutine->cs)】
+ * @note     临界区保证单一放入者；队列满时放入溢出列表
+ * @param    task
+ * @param    now
+ * @date     2026-10-17
+ */
 static void _Add_RunList(CO_TCB *task, uint64_t now)
 {
-    CO_Thread *c       = task->coroutine;
-    task->isAddRunList = 1;
-    task->execv_time   = now == 0 ? GetMillisecond() : now;
-    CM_NodeLink_Insert(&c->run_tasks, CM_NodeLink_End(c->run_tasks), &task->run_link);
-    c->run_count++;
+    CO_Thread *     c    = task->coroutine;
+    CO_TaskRunList *q    = &c->run_list[task->pri];
+    uint32_t        tail = CO_ATOMIC_LOAD_RELAXED(&q->tail);
+    task->execv_time     = now == 0 ? GetCoarseMicrosecond() : now;
+#if COROUTINE_PRIORITY_STARVATION_MS
+    if ((c->run_bitmap & (1 << task->pri)) == 0)
+        q->serve_time = task->execv_time;
+#endif
+    if (tail - CO_ATOMIC_LOAD(&q->head) < RUN_QUEUE_SIZE - 1) {   // 留一项：所属控制器先移动 head 再读取该项
+        CO_ATOMIC_STORE(&task->queued, 1);
+        CO_ATOMIC_STORE(&q->tasks[tail & (RUN_QUEUE_SIZE - 1)], task);
+        CO_ATOMIC_STORE(&q->tail, tail + 1);
+    } else {
+        task->isAddRunList = 1;
+        CM_NodeLink_Insert(&c->run_tasks[task->pri], CM_NodeLink_End(c->run_tasks[task->pri]), &task->run_link);
+    }
+    if ((c->run_bitmap & (1 << task->pri)) == 0) {
+        c->run_bitmap |= 1 << task->pri;
+        CO_ATOMIC_ADD(&C_Static.ready_threads[task->pri], 1);
+    }
+    CO_ATOMIC_ADD(&c->run_count, 1);
     return;
 }
 
@@ -610,47 +1592,83 @@ static void AddTaskList(CO_TCB *task, uint64_t now)
 }
 
 /**
- * @brief    获取休眠任务
- * @param    coroutine      
- * @param    ts             
- * @return   * uint64_t     
+ * @brief    批量唤醒到期任务，按控制器分组加入运行列表，每个控制器只唤醒一次
+ * @param    expired        到期任务 CO_TCB.run_link
+ * @param    ts             当前时间 us
+ * @date     2026-10-17
+ */
+static void _Wake_SleepTasks(CM_NodeLinkList_t *expired, uint64_t ts)
+{
+    while (!CM_NodeLink_IsEmpty(*expired)) {
+        CO_Thread *c = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(*expired))->coroutine;
+        CO_APP_ENTER(c->cs);
+        CM_NodeLink_t *p   = CM_NodeLink_First(*expired);
+        CM_NodeLink_t *end = CM_NodeLink_End(*expired);
+        while (p) {
+            CM_NodeLink_t *next = p == end ? NULL : p->next;
+            CO_TCB *       task = CM_Field_ToType(CO_TCB, run_link, p);
+            if (task->coroutine == c) {
+                CM_NodeLink_Remove(expired, p);
+                // 移出休眠列表后已被其他方式唤醒(信号量等)，不再重复加入
+                if (!task->isRuning && !task->isAddSleepList && !task->isAddRunList && !CO_ATOMIC_LOAD(&task->queued))
+                    _Add_RunList(task, ts);
+            }
+            p = next;
+        }
+        CO_APP_LEAVE(c->cs);
+        CheckAndWakeIdleThread(c);
+    }
+    return;
+}
+
+/**
+ * @brief    获取休眠任务，取出全部到期任务
+ * @param    ts             当前时间 us
+ * @return   uint64_t       距下一个休眠任务到期的时间 us
  * @author   CXS (chenxiangshu@outlook.com)
  * @date     2024-06-28
  */
-static uint32_t GetSleepTask(uint64_t ts)
+static uint64_t GetSleepTask(uint64_t ts)
 {
-    if (C_Static.idx_sleep == NULL)
-        return UINT32_MAX;
-    uint32_t tv  = UINT32_MAX;
-    CO_TCB * ret = NULL;
+    uint64_t          tv      = UINT64_MAX;
+    CM_NodeLinkList_t expired = NULL;
+#if COROUTINE_SLEEP_WHEEL
     CO_APP_ENTER(C_Static.cs_sleep);
-    ret = (CO_TCB *)C_Static.idx_sleep;
-    if (ret) {
-        if (ts < ret->execv_time) {
-            tv  = ret->execv_time - ts;
-            ret = NULL;
-        } else
-            ret = _Del_SleepList(ret);
+    _Wheel_Advance(ts, &expired);
+    _Update_SleepDeadline();
+    if (C_Static.sleep_wheel.count) {
+        // 下一个槽位开始时间(下放的槽位可能晚于此时间到期)
+        uint64_t next = C_Static.sleep_deadline;
+        tv            = next > ts ? next - ts : 0;
     }
     CO_APP_LEAVE(C_Static.cs_sleep);
-    if (ret == NULL)
+#else
+    CO_APP_ENTER(C_Static.cs_sleep);
+    CO_TCB *task;
+    while ((task = (CO_TCB *)C_Static.idx_sleep) != NULL) {
+        if (ts < task->execv_time) {
+            tv = task->execv_time - ts;
+            break;
+        }
+        _Del_SleepList(task);
+        CM_NodeLink_Insert(&expired, CM_NodeLink_End(expired), &task->run_link);
+    }
+    _Update_SleepDeadline();
+    CO_APP_LEAVE(C_Static.cs_sleep);
+#endif
+    if (CM_NodeLink_IsEmpty(expired))
         return tv;
-    CO_Thread *c = ret->coroutine;
-    CO_APP_ENTER(c->cs);
-    _Add_RunList(ret, ts);
-    CO_APP_LEAVE(c->cs);
-    CheckAndWakeIdleThread(c);
+    _Wake_SleepTasks(&expired, ts);
     return 0;
 }
 
-static void ReadyRun(CO_Thread *coroutine, CO_TCB *task)
+static void ReadyRun(CO_Thread *coroutine, CO_TCB *task, uint64_t now)
 {
     CO_APP_ENTER(coroutine->cs);
     task->isRuning = 1;   // 设置运行标志
 #if COROUTINE_ENABLE_PRINT_INFO
     if (task->execv_time) {
-        uint64_t now = GetMillisecond();
-        uint64_t tv  = now - task->execv_time;
+        uint64_t tv = now > task->execv_time ? (now - task->execv_time) / 1000 : 0;
         if (tv > task->run_max_timeout)
             task->run_max_timeout = tv;
         task->run_avg_timeout += tv;
@@ -659,70 +1677,536 @@ static void ReadyRun(CO_Thread *coroutine, CO_TCB *task)
     }
 #endif
     CO_APP_LEAVE(coroutine->cs);
+#if !COROUTINE_ENABLE_PRINT_INFO
+    (void)now;
+#endif
     return;
 }
 
-static CO_TCB *GetRunTask(uint16_t co_id, CO_Thread *coroutine)
+/**
+ * @brief    认领从就绪队列取出的项
+ * @param    task
+ * @return   true           认领成功 false：该项已作废(已被移除或在其他项中取走)
+ * @date     2026-10-18
+ */
+static inline bool _Claim_RunQueue(CO_TCB *task)
 {
-    CO_TCB *task = NULL;
-    for (uint16_t i = 0; i < Inter.thread_count && task == NULL; i++, co_id++) {
-        if (co_id >= Inter.thread_count) co_id = 0;
-        CO_Thread *c = C_Static.coroutines[co_id];
-        CO_APP_ENTER(c->cs);
-        if (c->run_tasks) {
-            task               = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(c->run_tasks));
-            task->isAddRunList = 0;
-            CM_NodeLink_Remove(&c->run_tasks, &task->run_link);
-            c->run_count--;
-            if (c->wake_count) c->wake_count--;
-            task->coroutine = coroutine;
+    // 过期项也可能认领到已重新加入其他队列的任务，按 task->coroutine 计数
+    int queued = 1;
+    if (CO_ATOMIC_CAS(&task->queued, &queued, 0)) {
+        _Claimed_RunCount(task->coroutine);
+        return true;
+    }
+    _Release_Task(task);   // 过期项
+    return false;
+}
+
+/**
+ * @brief    从本控制器的就绪队列取出一个任务(head 端，只由所属控制器调用)
+ * @note     先移动 head 再检查 tail，不使用 CAS；与窃取者争最后一个任务时恢复 head，在临界区内取出
+ * @param    c              协程控制器
+ * @param    pri            优先级
+ * @return   CO_TCB*        NULL：队列为空
+ * @date     2026-10-17
+ */
+static CO_TCB *_Pop_RunQueue(CO_Thread *c, int pri)
+{
+    CO_TaskRunList *q = &c->run_list[pri];
+    while (true) {
+        CO_TCB * task = NULL;
+        uint32_t head = CO_ATOMIC_LOAD_RELAXED(&q->head);
+        if (head == CO_ATOMIC_LOAD(&q->tail))
+            return NULL;
+        CO_ATOMIC_STORE(&q->head, head + 1);
+        CO_ATOMIC_FENCE();   // 与窃取者移动 tail 后的检查配对
+        if ((int32_t)(CO_ATOMIC_LOAD(&q->tail) - head) > 0) {
+            task = CO_ATOMIC_LOAD(&q->tasks[head & (RUN_QUEUE_SIZE - 1)]);
+        } else {
+            // 最后一个任务正在被窃取
+            CO_ATOMIC_STORE(&q->head, head);
+            CO_APP_ENTER(c->cs);
+            if (head != CO_ATOMIC_LOAD(&q->tail)) {
+                task = CO_ATOMIC_LOAD(&q->tasks[head & (RUN_QUEUE_SIZE - 1)]);
+                CO_ATOMIC_STORE(&q->head, head + 1);
+            }
+            CO_APP_LEAVE(c->cs);
+            if (task == NULL)
+                return NULL;
         }
-        CO_APP_LEAVE(c->cs);
+        if (_Claim_RunQueue(task))
+            return task;
     }
-    if (task) ReadyRun(coroutine, task);
-    return task;
 }
 
 /**
- * @brief    检查看门狗
- * @param    coroutine      
- * @author   CXS (chenxiangshu@outlook.com)
- * @date     2024-07-01
+ * @brief    从其他控制器的就绪队列窃取一个任务(tail 端) 【需要CO_APP_ENTER(c->cs)】
+ * @note     临界区与放入者和其他窃取者互斥；先移动 tail 再检查 head，与所属控制器争最后一个任务时放弃
+ * @param    c              被窃取的协程控制器
+ * @param    pri            优先级
+ * @return   CO_TCB*        NULL：队列为空
+ * @date     2026-10-18
  */
-static void CheckWatchdog(uint64_t now)
+static CO_TCB *_Steal_RunQueue(CO_Thread *c, int pri)
 {
-    volatile CO_TCB *t = C_Static.idx_watchdog;
-    if (t && t->watchdog && t->watchdog->expiration_time < now) {
-        // 看门狗超时
-        // ERROR_WATCHDOG_TIMEOUT(t);
-        C_Static.check_watchdog_time = 0;
+    CO_TaskRunList *q = &c->run_list[pri];
+    while (true) {
+        uint32_t tail = CO_ATOMIC_LOAD_RELAXED(&q->tail);
+        if (tail == CO_ATOMIC_LOAD(&q->head))
+            return NULL;
+        CO_ATOMIC_STORE(&q->tail, tail - 1);
+        CO_ATOMIC_FENCE();   // 与所属控制器移动 head 后的检查配对
+        if ((int32_t)(tail - 1 - CO_ATOMIC_LOAD(&q->head)) < 0) {
+            CO_ATOMIC_STORE(&q->tail, tail);   // 所属控制器正在取出最后一个任务
+            return NULL;
+        }
+        CO_TCB *task = CO_ATOMIC_LOAD(&q->tasks[(tail - 1) & (RUN_QUEUE_SIZE - 1)]);
+        if (_Claim_RunQueue(task))
+            return task;
     }
-    return;
 }
 
-static void __task(CO_TCB *n)
+/**
+ * @brief    取出指定优先级的就绪任务
+ * @param    c              协程控制器
+ * @param    pri            优先级
+ * @param    now            当前时间
+ * @param    isSteal        从其他控制器窃取
+ * @return   CO_TCB*        NULL：该优先级没有就绪任务(并清除位图)
+ * @date     2026-10-17
+ */
+static CO_TCB *_Pop_RunList(CO_Thread *c, int pri, uint64_t now, bool isSteal)
 {
-    // 执行任务
-    n->func(n->obj);
-    // 任务结束
-    CO_APP_ENTER(n->coroutine->cs);
-    n->isDel = true;
-    CO_APP_LEAVE(n->coroutine->cs);
-    // 回到调度器
-#if COROUTINE_CONTEXT_MODE == CONTEXT_JMP
-    longjmp(n->coroutine->env, 1);
-#elif COROUTINE_CONTEXT_MODE == CONTEXT_UCONTEXT
-    swapcontext(&n->env, &n->coroutine->env);
+    CO_TCB *task = NULL;
+    // 溢出列表中的任务较早，先取出；窃取者在临界区内从队列 tail 取出
+    if (isSteal || !CM_NodeLink_IsEmpty(c->run_tasks[pri])) {
+        CO_APP_ENTER(c->cs);
+        if (!CM_NodeLink_IsEmpty(c->run_tasks[pri])) {
+            task = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(c->run_tasks[pri]));
+            _Del_RunList(task);
+        } else if (isSteal)
+            task = _Steal_RunQueue(c, pri);
+        CO_APP_LEAVE(c->cs);
+    }
+    if (task == NULL && !isSteal)
+        task = _Pop_RunQueue(c, pri);
+    if (task) {
+#if COROUTINE_PRIORITY_STARVATION_MS
+        c->run_list[pri].serve_time = now;
 #endif
+        return task;
+    }
+    // 队列已空，在临界区内确认后清除位图
+    CO_APP_ENTER(c->cs);
+    CO_TaskRunList *q = &c->run_list[pri];
+    if ((c->run_bitmap & (1 << pri)) && CM_NodeLink_IsEmpty(c->run_tasks[pri]) &&
+        CO_ATOMIC_LOAD(&q->head) == CO_ATOMIC_LOAD(&q->tail)) {
+        c->run_bitmap &= ~(1 << pri);
+        CO_ATOMIC_SUB(&C_Static.ready_threads[pri], 1);
+    }
+    CO_APP_LEAVE(c->cs);
+    return NULL;
 }
 
-static STACK_TYPE *__GetStack(CO_TCB *n)
+/**
+ * @brief    选择就绪位图中要运行的优先级
+ * @param    c              协程控制器
+ * @param    bitmap         就绪位图
+ * @param    now            当前时间
+ * @return   int            优先级
+ * @date     2026-10-17
+ */
+static int _Select_Priority(CO_Thread *c, uint8_t bitmap, uint64_t now)
 {
-    // 栈对齐
-    STACK_TYPE *stack = NULL;
-    if (coroutine_get_stack_direction()) {
-        // 栈向上增长
-        stack = (STACK_TYPE *)(n->stack + 1);
+    int pri = CO_BITMAP_FIRST(bitmap);
+#if COROUTINE_PRIORITY_STARVATION_MS
+    // 饥饿上限：低优先级超时未被调度，先运行等待最久的
+    uint64_t serve_time = UINT64_MAX;
+    for (int i = pri + 1; i < MAX_PRIORITY_NUM; i++) {
+        if (!(bitmap & (1 << i)))
+            continue;
+        uint64_t t = c->run_list[i].serve_time;
+        if (t + CO_MS_TO_US(COROUTINE_PRIORITY_STARVATION_MS) <= now && t < serve_time) {
+            serve_time = t;
+            pri        = i;
+        }
+    }
+#endif
+    return pri;
+}
+
+/**
+ * @brief    任务是否可以在控制器上运行
+ * @param    task
+ * @param    c
+ * @return   true
+ * @date     2026-10-17
+ */
+static inline bool _Affinity_Allowed(CO_TCB *task, CO_Thread *c)
+{
+    return task->affinity == 0 || (c->co_id < COROUTINE_AFFINITY_BITS && (task->affinity >> c->co_id) & 1);
+}
+
+/**
+ * @brief    亲和掩码中运行数量最少的启用控制器
+ * @note     掩码中的控制器都已退役时忽略亲和，选择全部启用控制器中运行数量最少的
+ * @param    task
+ * @return   CO_Thread*
+ * @date     2026-10-17
+ */
+static CO_Thread *_Affinity_Target(CO_TCB *task)
+{
+    CO_Thread *ret = NULL;
+    for (int k = 0; k < 2 && ret == NULL; k++) {
+        for (size_t i = 0; i < Inter.thread_count; i++) {
+            CO_Thread *c = C_Static.coroutines[i];
+            if (CO_ATOMIC_LOAD_RELAXED(&c->isRetired) || (k == 0 && !_Affinity_Allowed(task, c)))
+                continue;
+            if (ret == NULL || CO_ATOMIC_LOAD_RELAXED(&c->run_count) < CO_ATOMIC_LOAD_RELAXED(&ret->run_count))
+                ret = c;
+        }
+    }
+    return ret == NULL ? task->coroutine : ret;
+}
+
+/**
+ * @brief    将已取出的任务放回指定控制器的就绪队列
+ * @param    task           已取出(认领)的任务
+ * @param    target         目标控制器
+ * @date     2026-10-17
+ */
+static void _Redirect_Task(CO_TCB *task, CO_Thread *target)
+{
+    CO_Thread *c = task->coroutine;
+    if (c != target) {
+        CO_APP_ENTER(c->cs);
+        task->coroutine = target;
+        CO_TASK_MIGRATED(task);
+        CO_APP_LEAVE(c->cs);
+    }
+    CO_APP_ENTER(target->cs);
+    _Add_RunList(task, task->execv_time);   // 保留入队时间
+    CO_APP_LEAVE(target->cs);
+    CheckAndWakeIdleThread(target);
+    return;
+}
+
+#if COROUTINE_WAKE_INBOX
+/**
+ * @brief    放入收件箱(任意线程，一次原子交换)
+ * @param    c              协程控制器
+ * @param    node
+ * @date     2026-10-17
+ */
+static void _Push_Inbox(CO_Thread *c, CO_InboxNode *node)
+{
+    CO_ATOMIC_STORE(&node->next, NULL);
+    CO_InboxNode *prev = CO_ATOMIC_XCHG_PTR(&c->inbox_tail, node);
+    CO_ATOMIC_STORE(&prev->next, node);   // 链接前消费者看不到该节点及之后的节点
+    return;
+}
+
+/**
+ * @brief    从收件箱取出 【只由所属控制器调用】
+ * @param    c              协程控制器
+ * @return   CO_InboxNode*  NULL：为空或放入者尚未完成链接
+ * @date     2026-10-17
+ */
+static CO_InboxNode *_Pop_Inbox(CO_Thread *c)
+{
+    CO_InboxNode *head = c->inbox_head;
+    CO_InboxNode *next = CO_ATOMIC_LOAD(&head->next);
+    if (head == &c->inbox_stub) {
+        if (next == NULL)
+            return NULL;
+        c->inbox_head = head = next;   // 跳过哨兵
+        next                 = CO_ATOMIC_LOAD(&head->next);
+    }
+    if (next == NULL) {
+        // 最后一个节点：放回哨兵后才能取出
+        if (head != CO_ATOMIC_LOAD(&c->inbox_tail))
+            return NULL;
+        _Push_Inbox(c, &c->inbox_stub);
+        next = CO_ATOMIC_LOAD(&head->next);
+        if (next == NULL)
+            return NULL;
+    }
+    c->inbox_head = next;
+    return head;
+}
+
+/**
+ * @brief    将收件箱中的任务转入就绪队列
+ * @note     只由所属控制器在调度前调用(单消费者)，窃取者不访问其他控制器的收件箱
+ * @param    c              协程控制器
+ * @date     2026-10-17
+ */
+static void _Drain_Inbox(CO_Thread *c)
+{
+    if (CO_ATOMIC_LOAD_RELAXED(&c->inbox_tail) == &c->inbox_stub)
+        return;   // 空
+    CM_NodeLinkList_t others = NULL;
+    CO_InboxNode *    node;
+    CO_APP_ENTER(c->cs);
+    while ((node = _Pop_Inbox(c)) != NULL) {
+        CO_TCB *task   = CM_Field_ToType(CO_TCB, inbox_link, node);
+        int     queued = 1;
+        if (!CO_ATOMIC_CAS(&task->queued, &queued, 0)) {
+            // 过期项：已被 DelTaskList 认领
+            CO_ATOMIC_STORE(&task->inboxed, 0);
+            _Release_Task(task);
+            continue;
+        }
+        CO_ATOMIC_STORE(&task->inboxed, 0);
+        _Claimed_RunCount(task->coroutine);
+        if (task->coroutine == c)
+            _Add_RunList(task, task->execv_time);   // 保留唤醒时间
+        else
+            CM_NodeLink_Insert(&others, CM_NodeLink_End(others), &task->run_link);
+    }
+    CO_APP_LEAVE(c->cs);
+    // 过期项认领到已加入其他控制器的任务，放回其所属控制器
+    while (!CM_NodeLink_IsEmpty(others)) {
+        CO_TCB *task = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(others));
+        CM_NodeLink_Remove(&others, &task->run_link);
+        _Redirect_Task(task, task->coroutine);
+    }
+    return;
+}
+#endif
+
+/**
+ * @brief    唤醒任务(加入所属控制器就绪队列)
+ * @note     其他控制器的任务放入其收件箱，无需获取其临界区(只在按控制器停放时，收件箱只能由所属控制器转入)；
+ *           task 需已由调用者移出全部列表(DelTaskList)且不在运行
+ * @param    task
+ * @date     2026-10-17
+ */
+static void _Wake_Task(CO_TCB *task)
+{
+    CO_Thread *c = task->coroutine;
+#if COROUTINE_WAKE_INBOX
+    int  inboxed = 0, parked = 1;
+    bool isPark  = Inter.events->park != NULL && Inter.events->unpark != NULL;   // 需要能唤醒指定控制器
+    if (isPark && c != _GetCurrentThread(-1, false) && task->execv_time == 0 && !task->isRuning && task->isRun &&
+        CO_ATOMIC_CAS(&task->inboxed, &inboxed, 1)) {
+        task->execv_time = GetCoarseMicrosecond();
+        CO_ATOMIC_ADD(&c->run_count, 1);
+        CO_ATOMIC_STORE(&task->queued, 1);
+        _Push_Inbox(c, &task->inbox_link);
+        // 收件箱只由所属控制器转入，只唤醒所属控制器(运行中时调度前会转入)
+        CO_ATOMIC_FENCE();   // 与 _Task 停放前的检查配对
+        if (CO_ATOMIC_CAS(&c->isParked, &parked, 0))
+            Inter.events->unpark(c->co_id, Inter.events->object);
+        return;
+    }
+#endif
+    CO_APP_ENTER(c->cs);
+    AddTaskList(task, 0);
+    CO_APP_LEAVE(c->cs);
+    CheckAndWakeIdleThread(c);
+    return;
+}
+
+/**
+ * @brief    其他控制器是否可能有比 pri 更高优先级的就绪任务
+ * @param    pri            本控制器最高就绪优先级 MAX_PRIORITY_NUM：本控制器没有就绪任务
+ * @return   true
+ * @date     2026-10-18
+ */
+static inline bool _Ready_Higher(int pri)
+{
+    for (int i = 0; i < pri; i++) {
+        if (CO_ATOMIC_LOAD_RELAXED(&C_Static.ready_threads[i]))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief    获取下一个运行任务
+ * @note     先查看本控制器；本控制器为空或其他控制器有更高优先级的就绪任务时，
+ *           再从随机位置开始查看其他控制器，取最高优先级(同级优先本控制器)
+ * @param    co_id          控制器ID
+ * @param    coroutine      协程控制器
+ * @param    now            当前时间 us
+ * @return   CO_TCB*        NULL：没有就绪任务
+ * @date     2026-10-17
+ */
+static CO_TCB *GetRunTask(uint16_t co_id, CO_Thread *coroutine, uint64_t now)
+{
+    CO_TCB * task    = NULL;
+    bool     isSteal = Inter.thread_count > 1;
+#if COROUTINE_WAKE_INBOX
+    _Drain_Inbox(coroutine);
+#endif
+    for (uint16_t n = 0; n < Inter.thread_count + MAX_PRIORITY_NUM && task == NULL; n++) {
+        // 读取就绪位图，选出最高优先级所在的控制器
+        CO_Thread *c      = coroutine;
+        uint8_t    bitmap = coroutine->run_bitmap;
+        int        pri    = bitmap ? CO_BITMAP_FIRST(bitmap) : MAX_PRIORITY_NUM;
+        if (pri != 0 && isSteal && _Ready_Higher(pri)) {
+            // xorshift 随机选择起始窃取对象
+            uint32_t r = coroutine->rand_seed;
+            r ^= r << 13;
+            r ^= r >> 17;
+            r ^= r << 5;
+            coroutine->rand_seed = r;
+            // 多个 NUMA 节点时先查看本节点的控制器，其他节点只取优先级更高的
+            for (int pass = C_Static.node_count > 1 ? 0 : 1; pass < 2 && pri != 0; pass++) {
+                for (uint16_t i = 1, id = co_id + 1 + r % (Inter.thread_count - 1); i < Inter.thread_count; i++, id++) {
+                    if (id >= Inter.thread_count) id -= Inter.thread_count;
+                    if (id == co_id) id = id + 1 >= Inter.thread_count ? 0 : id + 1;
+                    CO_Thread *v = C_Static.coroutines[id];
+                    if (pass == 0 ? v->node != coroutine->node : (C_Static.node_count > 1 && v->node == coroutine->node))
+                        continue;
+                    uint8_t bm = v->run_bitmap;
+                    if (bm && CO_BITMAP_FIRST(bm) < pri) {
+                        pri    = CO_BITMAP_FIRST(bm);
+                        c      = v;
+                        bitmap = bm;
+                        if (pri == 0) break;
+                    }
+                }
+            }
+        }
+        if (pri == MAX_PRIORITY_NUM)
+            break;   // 没有就绪任务
+        if (c == coroutine)
+            pri = _Select_Priority(c, bitmap, now);
+        task = _Pop_RunList(c, pri, now, c != coroutine);   // 位图可能已变化，取不到则重新选择
+        if (task && !_Affinity_Allowed(task, coroutine)) {
+            CO_Thread *t = task->coroutine;
+            if (t == coroutine || CO_ATOMIC_LOAD_RELAXED(&t->isRetired) || !_Affinity_Allowed(task, t))
+                t = _Affinity_Target(task);
+            if (t == coroutine) {
+                // 掩码中的控制器都已退役，忽略亲和
+            } else if (task->coroutine == coroutine) {
+                // 本控制器不在亲和掩码中，转移到掩码中的控制器
+                _Redirect_Task(task, t);
+                task = NULL;
+            } else if (task->isAffinityHard || now < task->execv_time + CO_MS_TO_US(COROUTINE_AFFINITY_SOFT_MS)) {
+                // 窃取：硬亲和不允许，软亲和等待超过上限才允许
+                _Redirect_Task(task, t);
+                task    = NULL;
+                isSteal = false;   // 本次只运行本控制器的任务
+            }
+        }
+        if (task && task->coroutine != coroutine) {
+            // 窃取：在原控制器临界区内转移，与唤醒者互斥
+            c = task->coroutine;
+#if COROUTINE_ENABLE_PRINT_INFO
+            coroutine->steal_count[c->node != coroutine->node]++;
+#endif
+            CO_APP_ENTER(c->cs);
+            task->coroutine = coroutine;
+            CO_TASK_MIGRATED(task);
+            CO_APP_LEAVE(c->cs);
+        }
+    }
+    if (task) ReadyRun(coroutine, task, now);
+    return task;
+}
+
+/**
+ * @brief    退役控制器：将收件箱和就绪队列中的任务转移到启用的控制器
+ * @param    coroutine      已退役的协程控制器
+ * @param    now            当前时间 us
+ * @date     2026-10-17
+ */
+static void _Retire_Drain(CO_Thread *coroutine, uint64_t now)
+{
+    CO_TCB *task;
+#if COROUTINE_WAKE_INBOX
+    _Drain_Inbox(coroutine);
+#endif
+    for (int pri = 0; pri < MAX_PRIORITY_NUM; pri++) {
+        while ((task = _Pop_RunList(coroutine, pri, now, false)) != NULL)
+            _Redirect_Task(task, _Affinity_Target(task));
+    }
+    return;
+}
+
+/**
+ * @brief    检查看门狗
+ * @param    coroutine      
+ * @author   CXS (chenxiangshu@outlook.com)
+ * @date     2024-07-01
+ */
+static void CheckWatchdog(uint64_t now)
+{
+    volatile CO_TCB *t = C_Static.idx_watchdog;
+    if (t && t->watchdog && t->watchdog->expiration_time < now) {
+        // 看门狗超时
+        // ERROR_WATCHDOG_TIMEOUT(t);
+        C_Static.check_watchdog_time = 0;
+    }
+    return;
+}
+
+/**
+ * @brief    处理到期的休眠任务和看门狗(同一时间只有一个执行者)
+ * @param    now            当前时间 us
+ * @date     2026-10-17
+ */
+static void CheckTimers(uint64_t now)
+{
+    int busy = 0;
+    if (!CO_ATOMIC_CAS(&C_Static.timer_busy, &busy, 1))
+        return;   // 其他控制器正在处理
+    CO_APP_ENTER(C_Static.cs_watchdogs);
+    CheckWatchdog(now);   // 检查看门狗
+    CO_APP_LEAVE(C_Static.cs_watchdogs);
+    GetSleepTask(now);   // 获取休眠任务
+    CO_ATOMIC_STORE(&C_Static.timer_busy, 0);
+    return;
+}
+
+/**
+ * @brief    获取下一个到期时间(休眠任务、看门狗)
+ * @param    now            当前时间 us
+ * @return   uint64_t       到期时间 us，UINT64_MAX：无
+ * @date     2026-10-17
+ */
+static uint64_t GetNextDeadline(uint64_t now)
+{
+    uint64_t deadline = CO_ATOMIC_LOAD(&C_Static.sleep_deadline);
+    CO_APP_ENTER(C_Static.cs_watchdogs);
+    volatile CO_TCB *t = C_Static.idx_watchdog;
+    if (t && t->watchdog) {
+        // 已超时的看门狗不再唤醒
+        uint64_t expiration = t->watchdog->expiration_time;
+        if (expiration > now && expiration < deadline)
+            deadline = expiration;
+    }
+    CO_APP_LEAVE(C_Static.cs_watchdogs);
+    return deadline;
+}
+
+static void __task(CO_TCB *n)
+{
+    // 执行任务
+    n->func(n->obj);
+    // 任务结束
+    CO_APP_ENTER(n->coroutine->cs);
+    n->isDel = true;
+    CO_APP_LEAVE(n->coroutine->cs);
+    // 回到调度器
+#if COROUTINE_CONTEXT_MODE == CONTEXT_JMP
+    longjmp(n->coroutine->env, 1);
+#elif COROUTINE_CONTEXT_MODE == CONTEXT_UCONTEXT
+    swapcontext(&n->env, &n->coroutine->env);
+#elif COROUTINE_CONTEXT_MODE == CONTEXT_ASM
+    coroutine_context_switch(n->env, n->coroutine->env[0]);
+#endif
+}
+
+static STACK_TYPE *__GetStack(CO_TCB *n)
+{
+    // 栈对齐
+    STACK_TYPE *stack = NULL;
+    if (coroutine_get_stack_direction()) {
+        // 栈向上增长
+        stack = (STACK_TYPE *)(n->stack + 1);
         while ((size_t)stack % sizeof(void *))
             stack++;
     } else {
@@ -768,79 +2252,121 @@ static void _enter_into(CO_TCB *n)
     }
     // 切换到任务
     swapcontext(&n->coroutine->env, &n->env);
+#elif COROUTINE_CONTEXT_MODE == CONTEXT_ASM
+    if (n->isFirst) {
+        // 设置已运行标志
+        n->isFirst = false;
+        // 在任务栈上构造初始寄存器帧
+        n->env[0] = coroutine_context_make(__GetStack(n), (void (*)(void *))__task, (void *)n);
+    }
+    // 切换到任务
+    coroutine_context_switch(n->coroutine->env, n->env[0]);
 #endif
     return;
 }
 
 /**
- * @brief    协程任务
- * @param    obj
+ * @brief    协程任务(运行一个任务)
+ * @param    coroutine      协程控制器
+ * @param    timeout        空闲等待超时 ms
+ * @param    ts             [in/out] 当前时间 us，返回时更新为任务结束(或空闲唤醒)时间
+ * @param    isIdle         没有任务时是否进入空闲等待
+ * @return   true           运行了一个任务
  * @author   CXS (chenxiangshu@outlook.com)
  * @date     2022-08-15
  */
-static void _Task(CO_Thread *coroutine, uint32_t timeout)
+static bool _Task(CO_Thread *coroutine, uint32_t timeout, uint64_t *ts, bool isIdle)
 {
-    static uint16_t _co_id   = 0xFFFF;
     CO_TCB *        n        = NULL;
-    uint32_t        sleep_ms = UINT32_MAX;
-    uint64_t        now      = GetMillisecond();   // 获取当前时间
-    bool            isSleep  = sleep_ms > 1 && Inter.events->Idle != NULL;
+    uint64_t        sleep_us = UINT64_MAX;
+    uint64_t        now      = *ts;   // 当前时间 us(批量运行时沿用上一个任务的结束时间)
+    coroutine->now           = now;
+    bool            isPark   = Inter.events->park != NULL && Inter.events->unpark != NULL;
+    bool            isSleep  = isIdle && (Inter.events->Idle != NULL || Inter.events->IdleUs != NULL || isPark);
+    bool            isRetire = CO_ATOMIC_LOAD_RELAXED(&coroutine->isRetired);
+    // 处理到期任务(外部毫秒中断可选)
+    if (now >= CO_ATOMIC_LOAD_RELAXED(&C_Static.sleep_deadline))
+        CheckTimers(now);
     // 获取下一个任务
-    n = GetRunTask(coroutine->co_id, coroutine);
+    if (isRetire)
+        _Retire_Drain(coroutine, now);   // 已退役：转移任务后停放，到期任务由启用的控制器处理
+    else
+        n = GetRunTask(coroutine->co_id, coroutine, now);
     if (n) {
         coroutine->idx_task        = n;
         coroutine->task_start_time = now;
         isSleep                    = false;
-    } else if (now - coroutine->task_start_time <= DELAY_CHECK) {
-        if (_co_id == 0xFFFF) _co_id = coroutine->co_id;
-        if (_co_id == coroutine->co_id)
+    } else if (!isRetire && now - coroutine->task_start_time < CO_MS_TO_US(DELAY_CHECK)) {
+        if (C_Static.delay_co_id == 0xFFFF) C_Static.delay_co_id = coroutine->co_id;
+        if (C_Static.delay_co_id == coroutine->co_id)
             isSleep = false;   // 延迟ms后再次检查是否有任务
     }
     if (isSleep) {
-        if (_co_id == coroutine->co_id)
-            _co_id = 0xFFFF;
+        if (C_Static.delay_co_id == coroutine->co_id)
+            C_Static.delay_co_id = 0xFFFF;
         CO_EnterCriticalSection();
         C_Static.SleepNum++;
         CO_LeaveCriticalSection();
 #if COROUTINE_ENABLE_PRINT_INFO
-        coroutine->sleep_start_time = now;
+        coroutine->sleep_start_time = now / 1000;
 #endif
     }
     if (n == NULL) {
         // 运行空闲任务
         if (isSleep) {
-            if (timeout && sleep_ms > timeout)
-                sleep_ms = timeout;
+            // 休眠到下一个到期时间
+            uint64_t deadline = isRetire ? UINT64_MAX : GetNextDeadline(now);
+            if (deadline != UINT64_MAX)
+                sleep_us = deadline > now ? deadline - now : 0;
+            if (timeout && timeout != UINT32_MAX && sleep_us > CO_MS_TO_US(timeout))
+                sleep_us = CO_MS_TO_US(timeout);
             // 执行空闲事件
-            Inter.events->Idle(sleep_ms - 1, Inter.events->object);
+            if (isPark) {
+                CO_ATOMIC_STORE(&coroutine->isParked, 1);
+                CO_ATOMIC_FENCE();
+                // 停放前再次检查，期间加入的任务不会被遗漏
+                if (CO_ATOMIC_LOAD(&coroutine->run_count) == 0)
+                    Inter.events->park(coroutine->co_id, sleep_us, Inter.events->object);
+                CO_ATOMIC_STORE(&coroutine->isParked, 0);
+            } else if (Inter.events->IdleUs != NULL)
+                Inter.events->IdleUs(sleep_us, Inter.events->object);
+            else if (sleep_us >= CO_MS_TO_US(UINT32_MAX - 1))
+                Inter.events->Idle(UINT32_MAX - 1, Inter.events->object);
+            else
+                Inter.events->Idle((sleep_us + 999) / 1000, Inter.events->object);   // 向上取整，避免提前唤醒空转
             // 空闲唤醒
             CO_EnterCriticalSection();
             C_Static.SleepNum--;
             CO_LeaveCriticalSection();
+            now            = GetMicrosecond();
+            coroutine->now = now;
+            CheckTimers(now);
 #if COROUTINE_ENABLE_PRINT_INFO
             // 计算休眠时间
-            now = GetMillisecond();
-            coroutine->sleep_time += now - coroutine->sleep_start_time;
+            coroutine->sleep_time += now / 1000 - coroutine->sleep_start_time;
+            coroutine->sleep_start_time = 0;
 #endif
+            *ts = now;
         }
-        return;
+        return false;
     }
-    if (_co_id == coroutine->co_id)
-        _co_id = 0xFFFF;
+    if (C_Static.delay_co_id == coroutine->co_id)
+        C_Static.delay_co_id = 0xFFFF;
 #if COROUTINE_ENABLE_PRINT_INFO
     // 记录切换次数
     coroutine->schedule_count++;
     // 记录运行时间
-    n->run_start_time = now;
+    n->run_start_time = now / 1000;
 #endif
     // 执行任务
     _enter_into(n);
     // 线程空闲
     coroutine->idx_task        = NULL;   // 控制器空闲
-    now                        = GetMillisecond();
+    now                        = GetMicrosecond();
+    coroutine->now             = now;
     coroutine->task_start_time = now;
 #if COROUTINE_ENABLE_PRINT_INFO
-    n->run_time += now - n->run_start_time;
+    n->run_time += now / 1000 - n->run_start_time;
 #endif
     // 添加到运行列表
     if (n->isDel) {
@@ -854,9 +2380,12 @@ static void _Task(CO_Thread *coroutine, uint32_t timeout)
         CO_APP_LEAVE(coroutine->cs);
     }
     // 周期事件
-    if (Inter.events->Period != NULL)
+    if (Inter.events->Period != NULL && now - coroutine->period_time >= COROUTINE_PERIOD_US) {
+        coroutine->period_time = now;
         Inter.events->Period(Inter.events->object);
-    return;
+    }
+    *ts = now;
+    return true;
 }
 
 static void _Switch_CheckStack(CO_TCB *n)
@@ -893,6 +2422,9 @@ static inline void _Switch_fast(CO_TCB *n, jmp_buf *dst_env)
 #elif COROUTINE_CONTEXT_MODE == CONTEXT_UCONTEXT
     // 跳转目标环境
     swapcontext(&n->env, dst_env);
+#elif COROUTINE_CONTEXT_MODE == CONTEXT_ASM
+    // 保存环境,跳转目标环境
+    coroutine_context_switch(n->env, (*dst_env)[0]);
 #endif
     return;
 }
@@ -932,26 +2464,38 @@ static void _Yield(CO_TCB *related)
     CO_Thread *coroutine = _GetCurrentThread(-1, false);
     if (coroutine == NULL || coroutine->idx_task == NULL)
         return;
-    uint64_t now      = GetMillisecond();
+    uint64_t now      = coroutine->now;   // 本轮调度时间，截止时间未到时切换出去，由调度重新判断
     CO_TCB * n        = coroutine->idx_task;
     bool     isSwitch = n->isDel || n->execv_time > now;
+    // 当前控制器不在亲和掩码中(运行中设置了亲和)：切换出去，由调度转移到掩码中的控制器
+    if (!isSwitch && !_Affinity_Allowed(n, coroutine) && _Affinity_Target(n) != coroutine)
+        isSwitch = true;
     // 检查后续相关
     if (related) {
-        if (isSwitch) {
+        if (isSwitch && related->coroutine != coroutine && _Affinity_Allowed(related, coroutine)) {
             // 将协程控制器让给相关协程
             related->coroutine = coroutine;
+            CO_TASK_MIGRATED(related);
+        } else if (!_Affinity_Allowed(related, related->coroutine)) {
+            // 所属控制器不在亲和掩码中，直接放入掩码中的控制器
+            related->coroutine = _Affinity_Target(related);
+            CO_TASK_MIGRATED(related);
         }
         CO_Thread *c = related->coroutine;
-        CO_APP_ENTER(c->cs);
-        AddTaskList(related, now);
-        CO_APP_LEAVE(c->cs);
         if (c != coroutine)
-            CheckAndWakeIdleThread(c);
+            _Wake_Task(related);
+        else {
+            CO_APP_ENTER(c->cs);
+            AddTaskList(related, now);
+            CO_APP_LEAVE(c->cs);
+        }
     }
     // 检查是否需要切换
     {
         if (!isSwitch) {
-            isSwitch = CheckAndWakeIdleThread(coroutine);
+            // 本控制器还有就绪任务时切换：已登记的唤醒不一定有控制器认领，到期任务只在调度中处理
+            CheckAndWakeIdleThread(coroutine);
+            isSwitch = CO_ATOMIC_LOAD_RELAXED(&coroutine->run_count) != 0;
         }
         if (!isSwitch)
             return;
@@ -961,6 +2505,25 @@ static void _Yield(CO_TCB *related)
     return;
 }
 
+/**
+ * @brief    当前线程已绑定的控制器(只读线程局部变量，不查找)
+ * @note     不支持线程局部变量时返回 NULL(初始化过程中也可调用)
+ * @return   CO_Thread*     NULL：不是控制器线程或尚未绑定
+ * @date     2026-10-18
+ */
+static inline CO_Thread *_Bound_Thread(void)
+{
+#if COROUTINE_THREAD_LOCAL
+#if COROUTINE_MULTI_INSTANCE
+    if (tls_sched != co_sched)
+        return NULL;   // 绑定的是其他实例的控制器
+#endif
+    return tls_thread;
+#else
+    return NULL;
+#endif
+}
+
 /**
  * @brief    获取当前协程控制器
  * @param    co_idx         协程索引
@@ -971,6 +2534,10 @@ static void _Yield(CO_TCB *related)
  */
 static CO_Thread *_GetCurrentThread(int co_idx, bool isAlloc)
 {
+#if COROUTINE_THREAD_LOCAL
+    if (co_idx < 0 && _Bound_Thread() != NULL)
+        return tls_thread;   // 线程已绑定当前实例的控制器
+#endif
     size_t     id  = Inter.GetThreadId();
     CO_Thread *ret = NULL;
     if (Inter.thread_count == 1) {
@@ -983,8 +2550,10 @@ static CO_Thread *_GetCurrentThread(int co_idx, bool isAlloc)
             ret = NULL;
     } else {
         if (co_idx < 0) {
-            if (C_Static.ThreadAllocNum == Inter.thread_count) {
-                int s = 0, idx = 0, e = Inter.thread_count - 1;
+            uint16_t num = C_Static.ThreadAllocNum;
+            if (num >= C_Static.ThreadInitNum) {
+                // 初始控制器已排序，二分查找；之后新增的控制器按绑定顺序查找
+                int s = 0, idx = 0, e = C_Static.ThreadInitNum - 1;
                 while (s <= e) {
                     idx = (s + e) >> 1;
                     if (C_Static.coroutines[idx]->ThreadId == id) {
@@ -995,7 +2564,12 @@ static CO_Thread *_GetCurrentThread(int co_idx, bool isAlloc)
                     else
                         e = idx - 1;
                 }
-            } else if (isAlloc) {
+                for (uint16_t i = C_Static.ThreadInitNum; i < num && ret == NULL; i++) {
+                    if (C_Static.coroutines[i]->ThreadId == id)
+                        ret = C_Static.coroutines[i];
+                }
+            }
+            if (ret == NULL && isAlloc) {
                 // 分配线程
                 CO_EnterCriticalSection();
                 bool isOk = true;
@@ -1005,27 +2579,50 @@ static CO_Thread *_GetCurrentThread(int co_idx, bool isAlloc)
                         break;
                     }
                 }
-                if (isOk) C_Static.coroutines[C_Static.ThreadAllocNum++]->ThreadId = id;
-                if (C_Static.ThreadAllocNum == Inter.thread_count) {
-                    // 排序
-                    for (int i = 0; i < Inter.thread_count; i++) {
-                        for (int j = i + 1; j < Inter.thread_count; j++) {
-                            if (C_Static.coroutines[j]->ThreadId < C_Static.coroutines[i]->ThreadId) {
-                                id                               = C_Static.coroutines[i]->ThreadId;
-                                C_Static.coroutines[i]->ThreadId = C_Static.coroutines[j]->ThreadId;
-                                C_Static.coroutines[j]->ThreadId = id;
+                if (isOk && C_Static.ThreadAllocNum < C_Static.ThreadOpenNum) {
+                    uint16_t   idx = C_Static.ThreadAllocNum;
+                    CO_Thread *c   = C_Static.coroutines[idx];
+                    c->ThreadId    = id;
+                    if (idx >= C_Static.ThreadInitNum) {
+                        // AddController 新增的控制器，绑定后立即运行
+#if COROUTINE_ENABLE_PRINT_INFO
+                        c->schedule_start_time = c->start_time = GetMillisecond();
+#endif
+                        ret = c;
+                    } else if (idx + 1 == C_Static.ThreadInitNum) {
+                        // 初始控制器全部绑定，排序
+                        for (int i = 0; i < C_Static.ThreadInitNum; i++) {
+                            for (int j = i + 1; j < C_Static.ThreadInitNum; j++) {
+                                if (C_Static.coroutines[j]->ThreadId < C_Static.coroutines[i]->ThreadId) {
+                                    id                               = C_Static.coroutines[i]->ThreadId;
+                                    C_Static.coroutines[i]->ThreadId = C_Static.coroutines[j]->ThreadId;
+                                    C_Static.coroutines[j]->ThreadId = id;
+                                }
                             }
                         }
                     }
+                    CO_ATOMIC_FENCE();   // 先写入 ThreadId
+                    C_Static.ThreadAllocNum = idx + 1;
                 }
                 CO_LeaveCriticalSection();
-                return NULL;
+                if (ret == NULL)
+                    return NULL;
             }
         } else {
             if (co_idx < Inter.thread_count)
                 ret = C_Static.coroutines[co_idx];
+            return ret;
         }
     }
+#if COROUTINE_THREAD_LOCAL
+    // 初始控制器分配完成后线程与控制器的对应关系不再变化；按(实例, 控制器)缓存，切换实例时保留
+    if (ret != NULL) {
+        tls_thread = ret;
+#if COROUTINE_MULTI_INSTANCE
+        tls_sched = co_sched;
+#endif
+    }
+#endif
     return ret;
 }
 
@@ -1035,70 +2632,242 @@ static CO_Thread *_GetCurrentThread(int co_idx, bool isAlloc)
  * @author   CXS (chenxiangshu@outlook.com)
  * @date     2022-08-17
  */
+/**
+ * @brief    控制器线程首次调度时通知接口(设置 CPU/内存亲和)
+ * @param    coroutine      
+ * @date     2026-10-17
+ */
+static inline void _Bind_Thread(CO_Thread *coroutine)
+{
+    if (coroutine->isBindThread)
+        return;
+    coroutine->isBindThread = 1;
+    if (Inter.BindThread != NULL)
+        Inter.BindThread(coroutine->co_id, coroutine->node);
+    return;
+}
+
 static bool Coroutine_RunTick(uint32_t timeout)
 {
     CO_Thread *coroutine = _GetCurrentThread(-1, true);
     if (coroutine == NULL)
         return false;
-    _Task(coroutine, timeout);
+    _Bind_Thread(coroutine);
+    uint64_t now = GetMicrosecond();
+    _Task(coroutine, timeout, &now, true);
     return !CM_NodeLink_IsEmpty(C_Static.task_list);
 }
 
+static uint32_t Coroutine_RunTicks(uint32_t timeout, uint32_t max_tasks, uint32_t max_us)
+{
+    CO_Thread *coroutine = _GetCurrentThread(-1, true);
+    if (coroutine == NULL)
+        return 0;
+    _Bind_Thread(coroutine);
+    uint32_t count = 0;
+    uint64_t now   = GetMicrosecond();
+    uint64_t end   = max_us ? now + max_us : UINT64_MAX;
+    // 没有就绪任务时：已运行过任务则返回，否则空闲等待一次
+    while (_Task(coroutine, timeout, &now, count == 0)) {
+        if (++count == max_tasks || now >= end)
+            break;
+    }
+    return count;
+}
+
+#if COROUTINE_ENABLE_PRINT_INFO
+/**
+ * @brief    控制器累计休眠时间(含正在进行的休眠)
+ * @param    c              协程控制器
+ * @param    now            当前时间 ms
+ * @return   uint64_t       ms
+ * @date     2026-10-17
+ */
+static uint64_t _Sleep_Time(CO_Thread *c, uint64_t now)
+{
+    uint64_t start = c->sleep_start_time;   // 非 0：正在休眠
+    return c->sleep_time + (start && now > start ? now - start : 0);
+}
+#endif
+
 static void Coroutine_MillisecondInterrupt(void)
 {
-    if (C_Static.ThreadAllocNum != Inter.thread_count)
+    if (C_Static.ThreadAllocNum < C_Static.ThreadInitNum)
         return;
-    uint64_t now = GetMillisecond();
-    CO_APP_ENTER(C_Static.cs_watchdogs);
-    CheckWatchdog(now);   // 检查看门狗
-    CO_APP_LEAVE(C_Static.cs_watchdogs);
-    GetSleepTask(now);   // 获取休眠任务
+    CheckTimers(GetMicrosecond());
     return;
 }
 
-static Coroutine_TaskId AddTask(Coroutine_Task    func,
-                                void *            pars,
-                                uint8_t           pri,
-                                const char *      name,
-                                uint32_t          stack_size,
-                                Coroutine_TaskId *taskId)
+static int AddController(bool *isNewThread)
 {
-    if (func == NULL)
-        return NULL;
-    stack_size = ALIGN(stack_size, sizeof(STACK_TYPE));
-    CO_TCB *n  = (CO_TCB *)Inter.Malloc(sizeof(CO_TCB), __FILE__, __LINE__);
-    if (n == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, sizeof(CO_TCB));
-    CM_ZERO(n);
-    n->func        = func;
-    n->obj         = pars;
-    n->stack       = NULL;
-    n->coroutine   = NULL;
-    n->isRun       = true;
-    n->isFirst     = true;
-    n->stack       = (STACK_TYPE *)Inter.Malloc(stack_size * sizeof(STACK_TYPE), __FILE__, __LINE__);   // 预分配 512 字节
-    n->stack_alloc = stack_size;
+    int  ret   = -1;
+    bool isNew = false;
+    CO_EnterCriticalSection();
+    // 优先重新启用已退役的控制器
+    for (uint16_t i = 0; i < C_Static.ThreadOpenNum && ret < 0; i++) {
+        if (CO_ATOMIC_LOAD_RELAXED(&C_Static.coroutines[i]->isRetired))
+            ret = i;
+    }
+    if (ret < 0 && C_Static.ThreadOpenNum < Inter.thread_count) {
+        ret   = C_Static.ThreadOpenNum++;   // 等待新线程绑定
+        isNew = true;
+    }
+    if (ret >= 0) {
+        CO_ATOMIC_STORE(&C_Static.coroutines[ret]->isRetired, 0);
+        C_Static.ActiveNum++;
+    }
+    CO_LeaveCriticalSection();
+    if (isNewThread != NULL)
+        *isNewThread = isNew;
+    return ret;
+}
+
+static bool RetireController(uint16_t co_id)
+{
+    if (co_id >= Inter.thread_count)
+        return false;
+    CO_Thread *c    = C_Static.coroutines[co_id];
+    bool       isOk = false;
+    CO_EnterCriticalSection();
+    if (co_id < C_Static.ThreadOpenNum && !CO_ATOMIC_LOAD_RELAXED(&c->isRetired) && C_Static.ActiveNum > 1) {
+        CO_ATOMIC_STORE(&c->isRetired, 1);
+        C_Static.ActiveNum--;
+        isOk = true;
+    }
+    CO_LeaveCriticalSection();
+    if (!isOk)
+        return false;
+    // 唤醒停放的控制器转移就绪任务
+    int parked = 1;
+    if (Inter.events->unpark != NULL && CO_ATOMIC_CAS(&c->isParked, &parked, 0))
+        Inter.events->unpark(co_id, Inter.events->object);
+    return true;
+}
+
+static bool GetControllerInfo(uint16_t co_id, Coroutine_ControllerInfo *info)
+{
+    if (co_id >= Inter.thread_count || info == NULL)
+        return false;
+    CO_Thread *c     = C_Static.coroutines[co_id];
+    info->isActive   = !CO_ATOMIC_LOAD_RELAXED(&c->isRetired);
+    info->isBound    = co_id < C_Static.ThreadAllocNum;
+    info->node       = c->node;
+    info->run_count  = CO_ATOMIC_LOAD_RELAXED(&c->run_count);
+    info->run_time   = 0;
+    info->sleep_time = 0;
 #if COROUTINE_ENABLE_PRINT_INFO
-    n->start_time = GetMillisecond();
+    if (info->isBound) {
+        uint64_t now     = GetMillisecond();
+        info->run_time   = now - c->start_time;
+        info->sleep_time = _Sleep_Time(c, now);
+    }
 #endif
-    CM_NodeLink_Init(&n->run_link);
-    if (name != NULL && name[0] != '\0') {
-        n->name = (char *)Inter.Malloc(32, __FILE__, __LINE__);
-        if (n->name == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, 32);
-        int s = strlen(name);
-        if (s > 31) s = 31;
-        memcpy(n->name, name, s + 1);
+    return true;
+}
+
+/**
+ * @brief    随机数(线程安全)
+ * @return   uint32_t
+ * @date     2026-10-17
+ */
+static uint32_t _Place_Rand(void)
+{
+    uint32_t x = CO_ATOMIC_ADD(&C_Static.place_seed, 0x9E3779B9u);
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @brief    从指定位置开始查找启用的控制器
+ * @param    idx            起始位置
+ * @return   CO_Thread*
+ * @date     2026-10-17
+ */
+static inline CO_Thread *_Active_Thread(size_t idx)
+{
+    CO_Thread *c = C_Static.coroutines[idx];
+    for (size_t i = 1; i < Inter.thread_count && CO_ATOMIC_LOAD_RELAXED(&c->isRetired); i++)
+        c = C_Static.coroutines[(idx + i) % Inter.thread_count];
+    return c;
+}
+
+/**
+ * @brief    选择新任务的控制器
+ * @param    placement      分配策略 Coroutine_Placement_t
+ * @return   CO_Thread*
+ * @date     2026-10-17
+ */
+static CO_Thread *_Place_Task(uint8_t placement)
+{
+    size_t num = Inter.thread_count;
+    if (num == 1)
+        return C_Static.coroutines[0];
+    if (placement == CO_PLACE_DEFAULT)
+        placement = C_Static.placement;
+    switch (placement) {
+        case CO_PLACE_ROUND_ROBIN:
+            return _Active_Thread(CO_ATOMIC_ADD(&C_Static.place_rr, 1) % num);
+        case CO_PLACE_LOCAL: {
+            CO_Thread *c = _GetCurrentThread(-1, false);
+            if (c && !CO_ATOMIC_LOAD_RELAXED(&c->isRetired)) return c;
+        }   // 协程外调用
+        default: {
+            // 随机两个控制器，取运行数量少的
+            uint32_t   r = _Place_Rand();
+            CO_Thread *a = _Active_Thread(r % num);
+            CO_Thread *b = _Active_Thread((r % num + 1 + (r >> 16) % (num - 1)) % num);
+            return CO_ATOMIC_LOAD_RELAXED(&b->run_count) < CO_ATOMIC_LOAD_RELAXED(&a->run_count) ? b : a;
+        }
     }
-#if COROUTINE_CHECK_STACK || COROUTINE_ENABLE_PRINT_INFO
-    // 初始化栈空间
-    memset(n->stack, 0xEE, n->stack_alloc * sizeof(STACK_TYPE));
+}
+
+static Coroutine_TaskId AddTask(Coroutine_Task    func,
+                                void *            pars,
+                                uint8_t           pri,
+                                const char *      name,
+                                uint32_t          stack_size,
+                                uint8_t           placement,
+                                Coroutine_TaskId *taskId)
+{
+    if (func == NULL)
+        return NULL;
+    stack_size   = ALIGN(stack_size, sizeof(STACK_TYPE));
+    CO_Thread *c = _Place_Task(placement);   // 先选择控制器，栈分配到其所在的 NUMA 节点
+    CO_TCB *   n = _Alloc_Task(stack_size, c->node);
+    n->func      = func;
+    n->obj       = pars;
+    n->coroutine = NULL;
+    n->isRun     = true;
+    n->isFirst   = true;
+    n->refs      = 1;
+    n->pri       = pri < MAX_PRIORITY_NUM ? pri : TASK_PRI_LOWEST;
+    n->init_pri  = n->pri;
+#if COROUTINE_ENABLE_MUTEX && COROUTINE_MUTEX_INHERIT
+    n->wait_mutex = NULL;
+    n->mutexes    = NULL;
 #endif
+#if COROUTINE_ENABLE_RWLOCK
+    memset(n->rwlock_holds, 0, sizeof(n->rwlock_holds));
+#endif
+#if COROUTINE_ENABLE_PRINT_INFO
+    n->start_time = GetMillisecond();
+#endif
+    CM_NodeLink_Init(&n->run_link);
+    int s = name == NULL ? 0 : strlen(name);
+    if (s > sizeof(n->name) - 1) s = sizeof(n->name) - 1;
+    memcpy(n->name, name, s);
+    n->name[s] = '\0';
     // 设置哨兵
-    n->stack[0]                  = STACK_SENTRY_END;
+    if (!n->isStackInter)
+        n->stack[0] = STACK_SENTRY_END;
     n->stack[n->stack_alloc - 1] = STACK_SENTRY_START;
     // 添加到任务列表
-    n->execv_time = GetMillisecond();
-    n->coroutine  = C_Static.coroutines[rand() % Inter.thread_count];   // 随机分配
-    CO_Thread *c  = n->coroutine;
+    n->execv_time = GetMicrosecond();
+    n->coroutine  = c;
     CO_APP_ENTER(C_Static.cs_task_list);
     CM_NodeLink_Insert(&C_Static.task_list, CM_NodeLink_End(C_Static.task_list), &n->task_list_link);
     CO_APP_LEAVE(C_Static.cs_task_list);
@@ -1122,7 +2891,26 @@ static Coroutine_TaskId Coroutine_AddTask(Coroutine_Task    func,
 {
     if (stack_size == 0)
         stack_size = C_Static.def_stack_size;
-    return AddTask(func, pars, pri, name, stack_size, taskId);
+    return AddTask(func, pars, pri, name, stack_size, CO_PLACE_DEFAULT, taskId);
+}
+
+static Coroutine_TaskId Coroutine_AddTaskPlacement(Coroutine_Task        func,
+                                                   void *                pars,
+                                                   uint8_t               pri,
+                                                   uint32_t              stack_size,
+                                                   const char *          name,
+                                                   Coroutine_Placement_t placement,
+                                                   Coroutine_TaskId *    taskId)
+{
+    if (stack_size == 0)
+        stack_size = C_Static.def_stack_size;
+    return AddTask(func, pars, pri, name, stack_size, placement, taskId);
+}
+
+static void SetPlacement(Coroutine_Placement_t placement)
+{
+    C_Static.placement = placement == CO_PLACE_DEFAULT ? COROUTINE_PLACEMENT : placement;
+    return;
 }
 
 /**
@@ -1166,17 +2954,17 @@ static void Coroutine_Yield(void)
 
 /**
  * @brief    转交控制权
- * @param    timeout        超时 0：不超时
- * @author   CXS (chenxiangshu@outlook.com)
- * @date     2022-08-15
+ * @param    timeout        超时 us 0：不超时
+ * @return   uint64_t       多耗时的部分 us
+ * @date     2026-10-17
  */
-static uint32_t Coroutine_YieldTimeOut(uint32_t timeout)
+static uint64_t Coroutine_YieldTimeOutUs(uint64_t timeout)
 {
     if (timeout == 0) {
         _Yield(NULL);
         return 0;
     }
-    uint64_t   ts        = GetMillisecond();
+    uint64_t   ts        = GetMicrosecond();
     CO_Thread *coroutine = _GetCurrentThread(-1, false);
     CO_TCB *   n         = coroutine->idx_task;
     // 设置超时时间
@@ -1186,8 +2974,20 @@ static uint32_t Coroutine_YieldTimeOut(uint32_t timeout)
     // 转交控制权
     ContextSwitch(n, coroutine);
     // 切换完成
-    ts = GetMillisecond() - ts;                         // 计算耗时
-    return ts > timeout ? (uint32_t)ts - timeout : 0;   // 返回误差
+    ts = GetMicrosecond() - ts;               // 计算耗时
+    return ts > timeout ? ts - timeout : 0;   // 返回误差
+}
+
+/**
+ * @brief    转交控制权
+ * @param    timeout        超时 ms 0：不超时
+ * @return   uint32_t       多耗时的部分 ms
+ * @author   CXS (chenxiangshu@outlook.com)
+ * @date     2022-08-15
+ */
+static uint32_t Coroutine_YieldTimeOut(uint32_t timeout)
+{
+    return (uint32_t)(Coroutine_YieldTimeOutUs(CO_MS_TO_US(timeout)) / 1000);
 }
 
 // --------------------------------------------------------------------------------------
@@ -1351,13 +3151,8 @@ static bool SendMail(Coroutine_Mailbox mb,
         CO_APP_LEAVE(mb->cs);
         if (_GetCurrentThread(-1, false))
             _Yield(related);   // 转移控制权
-        else if (related) {
-            CO_Thread *c = related->coroutine;
-            CO_APP_ENTER(c->cs);
-            AddTaskList(related, 0);   // 添加到任务列表
-            CO_APP_LEAVE(c->cs);
-            CheckAndWakeIdleThread(c);   // 唤醒线程
-        }
+        else if (related)
+            _Wake_Task(related);   // 唤醒线程
         return true;
     }
     // 加入消息列表
@@ -1405,9 +3200,9 @@ static Coroutine_MailData *GetMail(Coroutine_Mailbox mb,
     return ret;
 }
 
-static Coroutine_MailResult ReceiveMail(Coroutine_Mailbox mb,
-                                        uint64_t          eventId_Mask,
-                                        uint32_t          timeout)
+static Coroutine_MailResult ReceiveMailUs(Coroutine_Mailbox mb,
+                                          uint64_t          eventId_Mask,
+                                          uint64_t          timeout)
 {
     Coroutine_MailResult ret;
     CM_ZERO(&ret);
@@ -1472,6 +3267,13 @@ END:
     }
     return ret;
 }
+
+static Coroutine_MailResult ReceiveMail(Coroutine_Mailbox mb,
+                                        uint64_t          eventId_Mask,
+                                        uint32_t          timeout)
+{
+    return ReceiveMailUs(mb, eventId_Mask, CO_MS_TO_US(timeout));
+}
 #endif
 
 // --------------------------------------------------------------------------------------
@@ -1503,6 +3305,7 @@ static int _PrintInfoTask(char *   buf,
     if (max_size <= 0 || p == NULL) return 0;
     CheckStack(p);   // 检查栈
     uint64_t ts  = GetMillisecond();
+    uint64_t us  = GetMicrosecond();
     int      idx = 0;
     do {
         char stack[32];
@@ -1540,6 +3343,12 @@ static int _PrintInfoTask(char *   buf,
         if (idx >= max_size)
             break;
         idx += co_snprintf(buf + idx, max_size - idx, "%-6d ", p->coroutine == NULL ? -1 : p->coroutine->co_id);
+        if (idx >= max_size)
+            break;
+        idx += co_snprintf(buf + idx, max_size - idx, "%d|%-2d ", p->pri, p->init_pri);
+        if (idx >= max_size)
+            break;
+        idx += co_snprintf(buf + idx, max_size - idx, "%-5u ", p->migrations);
         if (idx >= max_size)
             break;
         const char *sta = "SLR";
@@ -1555,6 +3364,10 @@ static int _PrintInfoTask(char *   buf,
             sta = "SEM";
         else if (p->isWaitMutex)
             sta = "MUT";
+        else if (p->isWaitRWLock)
+            sta = "RWL";
+        else if (p->isWaitEvent)
+            sta = "EVT";
         else if (p->isDel)
             sta = "DEL";
         idx += co_snprintf(buf + idx, max_size - idx, " %4s  ", sta);
@@ -1566,7 +3379,7 @@ static int _PrintInfoTask(char *   buf,
         idx += co_snprintf(buf + idx, max_size - idx, "%s ", time);
         if (idx >= max_size)
             break;
-        tv = p->execv_time == 0 || p->execv_time <= ts ? 0 : p->execv_time - ts;
+        tv = p->execv_time == 0 || p->execv_time <= us ? 0 : (p->execv_time - us) / 1000;
         if (tv >= (UINT32_MAX >> 1))
             idx += co_snprintf(buf + idx, max_size - idx, "----       ");
         else
@@ -1585,12 +3398,12 @@ static int _PrintInfoTask(char *   buf,
         p->run_max_timeout = 0;
         if (idx >= max_size)
             break;
-        tv = p->watchdog == NULL ? 0 : p->watchdog->expiration_time - GetMillisecond();
+        tv = p->watchdog == NULL ? 0 : (p->watchdog->expiration_time - us) / 1000;
         if (tv >= (UINT32_MAX >> 1) || p->watchdog == NULL || p->watchdog->expiration_time == 0)
             idx += co_snprintf(buf + idx, max_size - idx, "----       ");
         else
             idx += co_snprintf(buf + idx, max_size - idx, "%-10u ", (uint32_t)tv);
-        idx += co_snprintf(buf + idx, max_size - idx, "%-32s", p->name == NULL ? "" : p->name);
+        idx += co_snprintf(buf + idx, max_size - idx, "%-32s", p->name);
         if (idx >= max_size)
             break;
         idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
@@ -1624,6 +3437,8 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
     else
         idx += co_snprintf(buf + idx, max_size - idx, "     Func       ");
     idx += co_snprintf(buf + idx, max_size - idx, "co_id ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Pri  ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Migr  ");
     idx += co_snprintf(buf + idx, max_size - idx, "Status ");
     // 打印堆栈大小
     int max_stack = 20;
@@ -1647,8 +3462,8 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
     // 统计总的运行时间
     uint64_t run_time = 0;
     uint64_t now      = GetMillisecond();
-    for (size_t i = 0; i < Inter.thread_count; i++)
-        run_time += now - C_Static.coroutines[i]->start_time - C_Static.coroutines[i]->sleep_time;
+    for (size_t i = 0; i < C_Static.ThreadAllocNum; i++)
+        run_time += now - C_Static.coroutines[i]->start_time - _Sleep_Time(C_Static.coroutines[i], now);
     if (run_time == 0) run_time = 1;
     CO_LeaveCriticalSection();
     int             count                 = 0;
@@ -1671,17 +3486,22 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
     uint64_t num_schedule_count = 0;
     CM_NodeLink_Foreach_Positive(CO_Thread, link, C_Static.threads, coroutine)
     {
+        if (coroutine->co_id >= C_Static.ThreadAllocNum)
+            continue;   // 未绑定线程
         now         = GetMillisecond();
         uint64_t tv = now - coroutine->start_time;
         if (tv == 0)
             tv = 1;
         CO_EnterCriticalSection();
-        uint64_t run_time              = tv - coroutine->sleep_time;
+        uint64_t run_time              = tv - _Sleep_Time(coroutine, now);
         void *   task                  = coroutine->idx_task;
         uint64_t schedule_count        = coroutine->schedule_count;
         uint64_t schedule_start_time   = coroutine->schedule_start_time;
+        uint32_t steal_local           = coroutine->steal_count[0];
+        uint32_t steal_remote          = coroutine->steal_count[1];
         coroutine->schedule_count      = 0;
         coroutine->schedule_start_time = GetMillisecond();
+        coroutine->steal_count[0] = coroutine->steal_count[1] = 0;
         CO_LeaveCriticalSection();
         schedule_start_time = GetMillisecond() - schedule_start_time;
         schedule_count      = schedule_start_time == 0 ? 0 : schedule_count * 1000 / schedule_start_time;
@@ -1689,7 +3509,7 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
         uint64_t a = run_time * 1000 / tv;
         idx += co_snprintf(buf + idx,
                            max_size - idx,
-                           "ThreadId: %llu(%u) RunTime: %llu(%d.%d%%) ms Schedule: %llu/s RunTask: %p Run: %u Wake: %u\r\n",
+                           "ThreadId: %llu(%u) RunTime: %llu(%d.%d%%) ms Schedule: %llu/s RunTask: %p Run: %u Wake: %u Node: %u Steal: %u/%u%s\r\n",
                            (uint64_t)coroutine->ThreadId,
                            coroutine->co_id,
                            run_time,
@@ -1698,7 +3518,11 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
                            schedule_count,
                            task,
                            coroutine->run_count,
-                           coroutine->wake_count);
+                           coroutine->wake_count,
+                           coroutine->node,
+                           steal_local,
+                           steal_remote,
+                           coroutine->isRetired ? " Retired" : "");
     }
     idx += co_snprintf(buf + idx,
                        max_size - idx,
@@ -1706,11 +3530,46 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
                        num_schedule_count,
                        (uint32_t)max_timeout,
                        avg_max_timeout_count == 0 ? 0 : (uint32_t)(avg_max_timeout / avg_max_timeout_count));
+#if COROUTINE_BLOCK_CRITICAL_SECTION && COROUTINE_CS_STATS
+    // ----------------------------- 临界区 -----------------------------
+    idx += co_snprintf(buf + idx, max_size - idx, " Lock           Acquire    Contend    Spin\r\n");
+    const char *  cs_name[] = {"task_list", "sleep", "semaphores", "mailboxes", "mutexes", "watchdogs", "task_pool"};
+    CO_APP_CS_t * cs_list[] = {C_Static.cs_task_list,
+                               C_Static.cs_sleep,
+                               C_Static.cs_semaphores,
+                               C_Static.cs_mailboxes,
+                               C_Static.cs_mutexes,
+                               C_Static.cs_watchdogs,
+                               C_Static.cs_task_pool};
+    const size_t  cs_num    = sizeof(cs_list) / sizeof(cs_list[0]);
+    for (size_t i = 0; i < cs_num + Inter.thread_count; i++) {
+        CO_APP_CS_t *cs;
+        char         name[16];
+        if (i < cs_num) {
+            cs = cs_list[i];
+            co_snprintf(name, sizeof(name), "%s", cs_name[i]);
+        } else {
+            CO_Thread *c = C_Static.coroutines[i - cs_num];
+            cs           = c->cs;
+            co_snprintf(name, sizeof(name), "thread(%u)", c->co_id);
+        }
+        // 读取并清零(本次获取计入下一周期)
+        CO_APP_ENTER(cs);
+        uint32_t acquire = cs->acquire - 1;
+        uint32_t contend = cs->contend;
+        uint64_t spin    = cs->spin;
+        cs->acquire = cs->contend = 0;
+        cs->spin                  = 0;
+        CO_APP_LEAVE(cs);
+        idx += co_snprintf(buf + idx, max_size - idx, " %-14s %-10u %-10u %llu\r\n", name, acquire, contend, spin);
+    }
+#endif
     // ----------------------------- 信号 -----------------------------
     idx += co_snprintf(buf + idx, max_size - idx, " SN  ");
     idx += co_snprintf(buf + idx, max_size - idx, "             Name              ");
     idx += co_snprintf(buf + idx, max_size - idx, "Value   ");
     idx += co_snprintf(buf + idx, max_size - idx, "Wait    ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Fast    ");
     idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
     int sn = 0;
     CO_APP_ENTER(C_Static.cs_semaphores);
@@ -1718,8 +3577,9 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
     {
         idx += co_snprintf(buf + idx, max_size - idx, "%5d ", ++sn);
         idx += co_snprintf(buf + idx, max_size - idx, "%-31s ", s->name);
-        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", s->value);
-        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", s->wait_count);
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", (uint32_t)CO_ATOMIC_LOAD(&s->value));
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", (uint32_t)CO_ATOMIC_LOAD(&s->wait_count));
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", (uint32_t)CO_ATOMIC_XCHG(&s->fast_count, 0));
         idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
     }
     CO_APP_LEAVE(C_Static.cs_semaphores);
@@ -1754,6 +3614,7 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
         idx += co_snprintf(buf + idx, max_size - idx, "Owner           ");
     idx += co_snprintf(buf + idx, max_size - idx, "Value   ");
     idx += co_snprintf(buf + idx, max_size - idx, "Wait    ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Spin    ");
     idx += co_snprintf(buf + idx, max_size - idx, "MaxWaitTime");
     idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
     sn = 0;
@@ -1762,14 +3623,70 @@ static int _PrintInfo(char *buf, int max_size, bool isEx)
     {
         idx += co_snprintf(buf + idx, max_size - idx, "%5d ", ++sn);
         idx += co_snprintf(buf + idx, max_size - idx, "%-31s ", m->name);
-        idx += co_snprintf(buf + idx, max_size - idx, "%p ", m->owner);
+        idx += co_snprintf(buf + idx, max_size - idx, "%p ", (void *)CO_ATOMIC_LOAD(&m->owner));
         idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", m->value);
-        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", m->wait_count);
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", (uint32_t)CO_ATOMIC_LOAD(&m->wait_count));
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", (uint32_t)CO_ATOMIC_XCHG(&m->spin_count, 0));
         idx += co_snprintf(buf + idx, max_size - idx, "%u ", m->max_wait_time);
         idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
         m->max_wait_time = 0;
     }
     CO_APP_LEAVE(C_Static.cs_mailboxes);
+#if COROUTINE_ENABLE_RWLOCK
+    // ----------------------------- 读写锁 -----------------------------
+    idx += co_snprintf(buf + idx, max_size - idx, " SN  ");
+    idx += co_snprintf(buf + idx, max_size - idx, "             Name              ");
+    if (sizeof(size_t) == 4)
+        idx += co_snprintf(buf + idx, max_size - idx, "Writer  ");
+    else
+        idx += co_snprintf(buf + idx, max_size - idx, "Writer          ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Readers ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Wait    ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Mode    ");
+    idx += co_snprintf(buf + idx, max_size - idx, "MaxWaitTime");
+    idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
+    sn = 0;
+    CO_APP_ENTER(C_Static.cs_mutexes);
+    CM_NodeLink_Foreach_Positive(CO_RWLock, link, C_Static.rwlocks, rw)
+    {
+        idx += co_snprintf(buf + idx, max_size - idx, "%5d ", ++sn);
+        idx += co_snprintf(buf + idx, max_size - idx, "%-31s ", rw->name);
+        idx += co_snprintf(buf + idx, max_size - idx, "%p ", (void *)CO_ATOMIC_LOAD(&rw->writer));
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8d ", _RWLock_Readers(rw));
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", rw->wait_count);
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8s ", rw->isWriterFirst ? "write" : "read");
+        idx += co_snprintf(buf + idx, max_size - idx, "%u ", rw->max_wait_time);
+        idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
+        rw->max_wait_time = 0;
+    }
+    CO_APP_LEAVE(C_Static.cs_mutexes);
+#endif
+#if COROUTINE_ENABLE_EVENT_GROUP
+    // ----------------------------- 事件组 -----------------------------
+    idx += co_snprintf(buf + idx, max_size - idx, " SN  ");
+    idx += co_snprintf(buf + idx, max_size - idx, "             Name              ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Value            ");
+    idx += co_snprintf(buf + idx, max_size - idx, "WaitBits         ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Wait    ");
+    idx += co_snprintf(buf + idx, max_size - idx, "Fast    ");
+    idx += co_snprintf(buf + idx, max_size - idx, "MaxWaitTime");
+    idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
+    sn = 0;
+    CO_APP_ENTER(C_Static.cs_mutexes);
+    CM_NodeLink_Foreach_Positive(CO_EventGroup, link, C_Static.event_groups, g)
+    {
+        idx += co_snprintf(buf + idx, max_size - idx, "%5d ", ++sn);
+        idx += co_snprintf(buf + idx, max_size - idx, "%-31s ", g->name);
+        idx += co_snprintf(buf + idx, max_size - idx, "%016llx ", (unsigned long long)CO_ATOMIC_LOAD(&g->value));
+        idx += co_snprintf(buf + idx, max_size - idx, "%016llx ", (unsigned long long)CO_ATOMIC_LOAD(&g->wait_mask));
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", g->wait_count);
+        idx += co_snprintf(buf + idx, max_size - idx, "%-8u ", (uint32_t)CO_ATOMIC_XCHG(&g->fast_count, 0));
+        idx += co_snprintf(buf + idx, max_size - idx, "%u ", g->max_wait_time);
+        idx += co_snprintf(buf + idx, max_size - idx, "\r\n");
+        g->max_wait_time = 0;
+    }
+    CO_APP_LEAVE(C_Static.cs_mutexes);
+#endif
     idx += co_snprintf(buf + idx,
                        max_size - idx,
                        "-------------------------------------------------------------------------------------------------------\r\n");
@@ -1801,8 +3718,8 @@ static Coroutine_Semaphore CreateSemaphore(const char *name, uint32_t init_val)
                                                      __LINE__);
     if (sem == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, sizeof(CO_Semaphore));
     memset(sem, 0, sizeof(CO_Semaphore));
-    sem->value = init_val;
-    sem->list  = NULL;
+    CO_ATOMIC_STORE(&sem->value, init_val);
+    sem->list = NULL;
     int s      = name == NULL ? 0 : strlen(name);
     if (s > sizeof(sem->name) - 1) s = sizeof(sem->name) - 1;
     memcpy(sem->name, name, s);
@@ -1840,10 +3757,29 @@ static void DeleteSemaphore(Coroutine_Semaphore _sem)
     return;
 }
 
+/**
+ * @brief    尝试扣减信号值
+ * @param    sem            信号量
+ * @param    val            数值
+ * @return   true           扣减成功
+ * @note     不加锁，可与快速路径并发
+ * @date     2026-10-17
+ */
+static inline bool _Sem_Take(CO_Semaphore *sem, uint32_t val)
+{
+    uint32_t v = CO_ATOMIC_LOAD(&sem->value);
+    while (v >= val) {
+        if (CO_ATOMIC_CAS(&sem->value, &v, v - val))
+            return true;
+    }
+    return false;
+}
+
 /**
  * @brief    给予信号量
  * @param    _sem           信号量
  * @param    val            数值
+ * @note     无等待者时只做原子加，不进临界区也不让出
  * @author   CXS (chenxiangshu@outlook.com)
  * @date     2022-08-17
  */
@@ -1852,20 +3788,32 @@ static void GiveSemaphore(Coroutine_Semaphore _sem, uint32_t val)
     CO_Semaphore *sem = (CO_Semaphore *)_sem;
     if (sem == NULL || val == 0)
         return;
+    // 快速路径：先加值再检查等待数，与等待方(先加等待数再检查值)配对，不会丢唤醒
+    if (CO_ATOMIC_LOAD(&sem->wait_count) == 0) {
+        CO_ATOMIC_ADD(&sem->value, val);
+        CO_ATOMIC_FENCE();
+        if (CO_ATOMIC_LOAD(&sem->wait_count) == 0) {
+#if COROUTINE_ENABLE_PRINT_INFO
+            CO_ATOMIC_ADD(&sem->fast_count, 1);
+#endif
+            return;
+        }
+        val = 0;   // 已加值，剩下只需唤醒
+    }
     bool              isOk  = false;
     CM_NodeLinkList_t tasks = NULL;
     CO_APP_ENTER(sem->cs);
-    sem->value += val;
+    if (val)
+        CO_ATOMIC_ADD(&sem->value, val);
     while (!CM_NodeLink_IsEmpty(sem->list)) {
         SemaphoreNode *n = CM_Field_ToType(SemaphoreNode, link, CM_NodeLink_First(sem->list));
-        if (n == NULL || n->number > sem->value)
+        if (n == NULL || !_Sem_Take(sem, n->number))
             break;
-        sem->value -= n->number;
         n->isOk      = true;
         CO_TCB *task = (CO_TCB *)n->task;
         // 移除等待列表
         CM_NodeLink_Remove(&sem->list, &n->link);
-        sem->wait_count--;
+        CO_ATOMIC_SUB(&sem->wait_count, 1);
         // 加入运行列表
         CO_Thread *c = task->coroutine;
         CO_APP_ENTER(c->cs);
@@ -1885,11 +3833,7 @@ static void GiveSemaphore(Coroutine_Semaphore _sem, uint32_t val)
     while (!CM_NodeLink_IsEmpty(tasks)) {
         CO_TCB *task = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(tasks));
         CM_NodeLink_Remove(&tasks, &task->run_link);
-        CO_Thread *c = task->coroutine;
-        CO_APP_ENTER(c->cs);
-        AddTaskList(task, 0);
-        CO_APP_LEAVE(c->cs);
-        CheckAndWakeIdleThread(c);   // 唤醒线程
+        _Wake_Task(task);   // 唤醒线程
     }
     if (isOk) {
         if (_GetCurrentThread(-1, false))
@@ -1902,13 +3846,13 @@ static void GiveSemaphore(Coroutine_Semaphore _sem, uint32_t val)
  * @brief    等待信号量
  * @param    _sem           信号量
  * @param    val            数值
- * @param    timeout        超时
+ * @param    timeout        超时 us
  * @return   true
  * @return   false
  * @author   CXS (chenxiangshu@outlook.com)
  * @date     2022-08-17
  */
-static bool WaitSemaphore(Coroutine_Semaphore _sem, uint32_t val, uint32_t timeout)
+static bool WaitSemaphoreUs(Coroutine_Semaphore _sem, uint32_t val, uint64_t timeout)
 {
     if (val == 0)
         return true;
@@ -1916,14 +3860,21 @@ static bool WaitSemaphore(Coroutine_Semaphore _sem, uint32_t val, uint32_t timeo
     CO_Thread *   c   = _GetCurrentThread(-1, false);
     if (sem == NULL || c == NULL || c->idx_task == NULL)
         return false;
+    // 快速路径：信号足够直接扣减
+    if (_Sem_Take(sem, val)) {
+#if COROUTINE_ENABLE_PRINT_INFO
+        CO_ATOMIC_ADD(&sem->fast_count, 1);
+#endif
+        return true;
+    }
     CO_TCB *      task = c->idx_task;
     bool          isOk = false;
-    uint64_t      now  = GetMillisecond();
+    uint64_t      now  = GetMicrosecond();
     SemaphoreNode tmp;
     do {
         // 计算剩余等待时间
-        uint64_t tv = GetMillisecond() - now;
-        if (tv >= (uint64_t)timeout)
+        uint64_t tv = GetMicrosecond() - now;
+        if (tv >= timeout)
             tv = 0;
         else
             tv = timeout - tv;
@@ -1931,8 +3882,11 @@ static bool WaitSemaphore(Coroutine_Semaphore _sem, uint32_t val, uint32_t timeo
         SemaphoreNode *n = &tmp;
         CM_ZERO(n);
         CO_APP_ENTER(sem->cs);
-        if (sem->value >= val) {
-            sem->value -= val;
+        // 先登记等待再检查信号值，给予方快速路径据此决定是否进入慢路径
+        CO_ATOMIC_ADD(&sem->wait_count, 1);
+        CO_ATOMIC_FENCE();
+        if (_Sem_Take(sem, val)) {
+            CO_ATOMIC_SUB(&sem->wait_count, 1);
             isOk = true;
         } else {
             n->task      = task;
@@ -1940,194 +3894,1180 @@ static bool WaitSemaphore(Coroutine_Semaphore _sem, uint32_t val, uint32_t timeo
             n->number    = val;
             n->semaphore = sem;
             // 加入等待列表
-            CM_NodeLink_Insert(&sem->list, CM_NodeLink_End(sem->list), &n->link);
-            // 计数
-            sem->wait_count++;
+            CM_NodeLink_Insert(&sem->list, CM_NodeLink_End(sem->list), &n->link);
+            CO_APP_ENTER(c->cs);
+            // 设置等待标志
+            task->isWaitSem = true;
+            // 设置超时
+            CO_SET_TASK_TIME(task, tv);
+            CO_APP_LEAVE(c->cs);
+        }
+        CO_APP_LEAVE(sem->cs);
+        if (isOk) {
+            // 已经获取到信号，直接返回
+            return true;
+        }
+        // 等待
+        _Yield(NULL);
+        CO_APP_ENTER(sem->cs);
+        if (n->isOk)
+            isOk = true;
+        c = task->coroutine;
+        CO_APP_ENTER(c->cs);
+        if (task->isWaitSem) {
+            task->isWaitSem = false;
+            // 移除等待列表
+            CM_NodeLink_Remove(&sem->list, &n->link);
+            // 设置计数器
+            CO_ATOMIC_SUB(&sem->wait_count, 1);
+        }
+        CO_APP_LEAVE(c->cs);
+        CO_APP_LEAVE(sem->cs);
+    } while (!isOk && GetMicrosecond() - now < timeout);
+    return isOk;
+}
+
+static bool WaitSemaphore(Coroutine_Semaphore _sem, uint32_t val, uint32_t timeout)
+{
+    return WaitSemaphoreUs(_sem, val, CO_MS_TO_US(timeout));
+}
+#endif
+
+/**
+ * @brief    设置任务当前优先级
+ * @param    task           任务
+ * @param    pri            优先级
+ * @param    isInit         同时设置初始优先级(被继承提升时保留提升)
+ * @note     就绪中的任务移动到新的优先级队列
+ * @date     2026-10-18
+ */
+static void _Set_Priority(CO_TCB *task, uint8_t pri, bool isInit)
+{
+    CO_Thread *c = NULL;
+    while (true) {
+        c = task->coroutine;
+        CO_APP_ENTER(c->cs);
+        if (c == task->coroutine)
+            break;
+        CO_APP_LEAVE(c->cs);   // 任务已被其他控制器取走，重新获取
+    }
+    if (isInit) {
+        bool isInherit = task->pri < task->init_pri;
+        task->init_pri = pri;
+        if (isInherit && task->pri < pri)
+            pri = task->pri;   // 保留继承的优先级，解锁时重新计算
+    }
+    if (task->pri != pri && _Del_RunList(task)) {
+        // 移动到新的优先级队列
+        task->pri = pri;
+        _Add_RunList(task, task->execv_time);
+    } else
+        task->pri = pri;
+    CO_APP_LEAVE(c->cs);
+    return;
+}
+
+// --------------------------------------------------------------------------------------
+//                              |       互斥        |
+// --------------------------------------------------------------------------------------
+
+#if COROUTINE_ENABLE_MUTEX
+#if COROUTINE_MUTEX_INHERIT
+#define CO_MUTEX_INHERIT_DEPTH 8   // 优先级继承最大传递层数
+
+/**
+ * @brief    按优先级加入等待列表(同优先级先到先得)
+ * @param    mutex          互斥锁
+ * @param    n              等待节点
+ * @note     需持有 mutex->cs
+ * @date     2026-10-18
+ */
+static void _Mutex_Enqueue(CO_Mutex *mutex, MutexWaitNode *n)
+{
+    CM_NodeLink_Foreach_Reverse(MutexWaitNode, link, mutex->list, p)
+    {
+        if (p->task->pri <= n->task->pri) {
+            CM_NodeLink_Insert(&mutex->list, &p->link, &n->link);
+            return;
+        }
+    }
+    CM_NodeLink_SetHeadNode(&mutex->list, &n->link);
+    return;
+}
+
+/**
+ * @brief    优先级继承：沿等待链提升持有者优先级
+ * @param    mutex          等待的互斥锁
+ * @param    task           等待任务
+ * @note     每次只持有一个互斥锁临界区；持有者也在等待时，按新优先级重新排队并继续提升下一个持有者
+ * @date     2026-10-18
+ */
+static void _Mutex_Inherit(CO_Mutex *mutex, CO_TCB *task)
+{
+    uint8_t pri = task->pri;
+    for (int depth = 0; depth < CO_MUTEX_INHERIT_DEPTH; depth++) {
+        CO_Mutex *next = NULL;
+        CO_APP_ENTER(mutex->cs);
+        if (depth && task->wait_mutex == mutex) {
+            // 按提升后的优先级重新排队
+            CM_NodeLink_Remove(&mutex->list, &task->wait_node->link);
+            _Mutex_Enqueue(mutex, task->wait_node);
+        }
+        CO_TCB *owner = CO_ATOMIC_LOAD(&mutex->owner);
+        if (owner != NULL && owner != task && owner->pri > pri) {
+            _Set_Priority(owner, pri, false);
+            next = owner->wait_mutex;
+        }
+        CO_APP_LEAVE(mutex->cs);
+        if (next == NULL)
+            break;
+        mutex = next;
+        task  = owner;
+    }
+    return;
+}
+
+/**
+ * @brief    解锁后恢复优先级
+ * @param    task           解锁任务
+ * @note     取初始优先级和仍持有的互斥锁中最高等待者优先级
+ * @date     2026-10-18
+ */
+static void _Mutex_Restore(CO_TCB *task)
+{
+    if (task->pri == task->init_pri)
+        return;
+    uint8_t pri = task->init_pri;
+    CM_NodeLink_Foreach_Positive(CO_Mutex, owner_link, task->mutexes, m)
+    {
+        CO_APP_ENTER(m->cs);
+        if (!CM_NodeLink_IsEmpty(m->list)) {
+            MutexWaitNode *n = CM_Field_ToType(MutexWaitNode, link, CM_NodeLink_First(m->list));
+            if (n->task->pri < pri)
+                pri = n->task->pri;
+        }
+        CO_APP_LEAVE(m->cs);
+    }
+    _Set_Priority(task, pri, false);
+    return;
+}
+
+// 记录/移除持有的互斥锁(只由持有者访问)
+#define CO_MUTEX_HELD(task, mutex) CM_NodeLink_Insert(&(task)->mutexes, CM_NodeLink_End((task)->mutexes), &(mutex)->owner_link)
+#define CO_MUTEX_DROP(task, mutex) CM_NodeLink_Remove(&(task)->mutexes, &(mutex)->owner_link)
+#else
+#define CO_MUTEX_HELD(task, mutex)
+#define CO_MUTEX_DROP(task, mutex)
+#endif
+static Coroutine_Mutex CreateMutex(const char *name)
+{
+    CO_Mutex *mutex = (CO_Mutex *)Inter.Malloc(sizeof(CO_Mutex), __FILE__, __LINE__);
+    if (mutex == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, sizeof(CO_Mutex));
+    memset(mutex, 0, sizeof(CO_Mutex));
+    int s = name == NULL ? 0 : strlen(name);
+    if (s > sizeof(mutex->name) - 1) s = sizeof(mutex->name) - 1;
+    memcpy(mutex->name, name, s);
+    mutex->name[s] = '\0';
+    // 加入列表
+    CO_APP_ENTER(C_Static.cs_mutexes);
+    CM_NodeLink_Insert(&C_Static.mutexes, CM_NodeLink_End(C_Static.mutexes), &mutex->link);
+    CO_APP_LEAVE(C_Static.cs_mutexes);
+    return mutex;
+}
+
+static void DeleteMutex(Coroutine_Mutex mutex)
+{
+    if (mutex == NULL)
+        return;
+    CO_APP_ENTER(mutex->cs);
+    if (!CM_NodeLink_IsEmpty(mutex->list))
+        ERROR_MUTEX_DELETE(mutex);
+    CO_APP_LEAVE(mutex->cs);
+    // 移除列表
+    CO_APP_ENTER(C_Static.cs_mutexes);
+    CM_NodeLink_Remove(&C_Static.mutexes, &mutex->link);
+    CO_APP_LEAVE(C_Static.cs_mutexes);
+    Inter.Free(mutex, __FILE__, __LINE__);
+    return;
+}
+
+#if COROUTINE_MUTEX_SPIN && COROUTINE_BLOCK_CRITICAL_SECTION
+/**
+ * @brief    自旋等待互斥锁
+ * @param    mutex          互斥锁
+ * @param    task           当前任务
+ * @param    c              当前控制器
+ * @return   true           自旋期间获取到锁
+ * @note     只在持有者正在其他控制器运行时自旋(很快会释放)，持有者挂起或有排队者时立即放弃；
+ *           持有者可能随时解锁并被删除，只比较记录的控制器当前运行的任务，不访问持有者
+ * @date     2026-10-17
+ */
+static bool _Mutex_Spin(CO_Mutex *mutex, CO_TCB *task, CO_Thread *c)
+{
+    for (uint32_t i = COROUTINE_MUTEX_SPIN; i; i--) {
+        CO_TCB *owner = CO_ATOMIC_LOAD_RELAXED(&mutex->owner);
+        if (owner == NULL) {
+            if (CO_ATOMIC_LOAD_RELAXED(&mutex->wait_count))
+                return false;   // 不插队
+            if (CO_ATOMIC_CAS_PTR(&mutex->owner, &owner, task)) {
+                CO_ATOMIC_STORE(&mutex->owner_thread, c);
+#if COROUTINE_ENABLE_PRINT_INFO
+                CO_ATOMIC_ADD(&mutex->spin_count, 1);
+#endif
+                return true;
+            }
+            continue;
+        }
+        CO_Thread *oc = CO_ATOMIC_LOAD_RELAXED(&mutex->owner_thread);
+        if (oc == NULL || oc == c || oc->idx_task != owner)
+            return false;   // 持有者未在运行
+        CO_CPU_RELAX();
+    }
+    return false;
+}
+#endif
+
+/**
+ * @brief    锁定互斥锁
+ * @param    mutex          互斥锁
+ * @param    timeout        超时 us
+ * @return   true           获取成功
+ * @note     无竞争时 CAS 持有者直接返回；竞争时先有限自旋，再加入等待列表挂起
+ * @date     2026-10-17
+ */
+static bool LockMutexUs(Coroutine_Mutex mutex, uint64_t timeout)
+{
+    CO_Thread *c = _GetCurrentThread(-1, false);
+    if (mutex == NULL || c == NULL || c->idx_task == NULL)
+        return false;
+    CO_TCB *task  = c->idx_task;
+    CO_TCB *owner = NULL;
+    // 快速路径
+    if (CO_ATOMIC_CAS_PTR(&mutex->owner, &owner, task)) {
+        CO_ATOMIC_STORE(&mutex->owner_thread, c);
+        mutex->value = 1;
+        CO_MUTEX_HELD(task, mutex);
+        return true;
+    }
+    if (owner == task) {
+        // 已经锁定
+        mutex->value++;
+        return true;
+    }
+#if COROUTINE_MUTEX_SPIN && COROUTINE_BLOCK_CRITICAL_SECTION
+    if (timeout && _Mutex_Spin(mutex, task, c)) {
+        mutex->value = 1;
+        CO_MUTEX_HELD(task, mutex);
+        return true;
+    }
+#endif
+    bool          isOk = false;
+    uint64_t      now  = GetMicrosecond();
+    MutexWaitNode wait;
+    CM_ZERO(&wait);
+    wait.task = task;
+    do {
+        // 计算剩余等待时间
+        uint64_t tv = GetMicrosecond() - now;
+        if (tv >= timeout)
+            tv = 0;
+        else
+            tv = timeout - tv;
+        CO_APP_ENTER(mutex->cs);
+        MutexWaitNode *wait_mutex = &wait;
+        // 先登记等待再尝试获取，解锁方快速路径据此决定是否进入慢路径
+        CO_ATOMIC_ADD(&mutex->wait_count, 1);
+        CO_ATOMIC_FENCE();
+        owner = NULL;
+        if (CO_ATOMIC_CAS_PTR(&mutex->owner, &owner, task)) {
+            // 获取锁
+            CO_ATOMIC_STORE(&mutex->owner_thread, c);
+            CO_ATOMIC_SUB(&mutex->wait_count, 1);
+            mutex->value      = 1;
+            wait_mutex->mutex = mutex;
+            isOk              = true;
+            CO_MUTEX_HELD(task, mutex);
+        } else {
+            // 等待锁
+#if COROUTINE_MUTEX_INHERIT
+            _Mutex_Enqueue(mutex, wait_mutex);
+            task->wait_mutex = mutex;
+            task->wait_node  = wait_mutex;
+#else
+            CM_NodeLink_Insert(&mutex->list, CM_NodeLink_End(mutex->list), &wait_mutex->link);
+#endif
+            wait_mutex->mutex = mutex;
+            wait_mutex->time  = now;
+            CO_APP_ENTER(c->cs);
+            // 设置等待标志
+            task->isWaitMutex = true;
+            // 设置超时
+            CO_SET_TASK_TIME(task, tv);
+            CO_APP_LEAVE(c->cs);
+        }
+        CO_APP_LEAVE(mutex->cs);
+        if (isOk) return true;   // 获取锁成功
+#if COROUTINE_MUTEX_INHERIT
+        _Mutex_Inherit(mutex, task);
+#endif
+        // 等待
+        _Yield(NULL);
+        CO_APP_ENTER(mutex->cs);
+        // 移除等待列表
+        CM_NodeLink_Remove(&mutex->list, &wait_mutex->link);
+#if COROUTINE_MUTEX_INHERIT
+        task->wait_mutex = NULL;
+#endif
+        c = task->coroutine;
+        CO_APP_ENTER(c->cs);
+        if (task->isWaitMutex) {
+            CO_ATOMIC_SUB(&mutex->wait_count, 1);
+            task->isWaitMutex = false;
+        }
+        CO_APP_LEAVE(c->cs);
+        isOk = CO_ATOMIC_LOAD(&mutex->owner) == task;
+        if (isOk) {
+            CO_ATOMIC_STORE(&mutex->owner_thread, c);   // 被转交后恢复运行
+            CO_MUTEX_HELD(task, mutex);
+        }
+        CO_APP_LEAVE(mutex->cs);
+    } while (!isOk && (GetMicrosecond() - now) < timeout);
+    return isOk;
+}
+
+static bool LockMutex(Coroutine_Mutex mutex, uint32_t timeout)
+{
+    return LockMutexUs(mutex, CO_MS_TO_US(timeout));
+}
+
+/**
+ * @brief    解锁互斥锁
+ * @param    mutex          互斥锁
+ * @note     无等待者时只清除持有者；有等待者时直接转交给队首并唤醒，不让出控制权
+ * @date     2026-10-17
+ */
+static void UnlockMutex(Coroutine_Mutex mutex)
+{
+    CO_Thread *c = _GetCurrentThread(-1, false);
+    if (mutex == NULL || c == NULL || c->idx_task == NULL)
+        return;
+    CO_TCB *task = c->idx_task;
+    if (CO_ATOMIC_LOAD_RELAXED(&mutex->owner) != task) {
+        ERROR_MUTEX_RELIEVE(task, mutex);   // 解锁异常
+        return;
+    }
+    // 解锁
+    if (--mutex->value)
+        return;
+#if COROUTINE_MUTEX_INHERIT
+    CO_TCB *self = task;
+#endif
+    CO_MUTEX_DROP(task, mutex);
+    // 快速路径：先清除持有者再检查等待数，与等待方(先加等待数再 CAS)配对
+    if (CO_ATOMIC_LOAD(&mutex->wait_count) == 0) {
+        CO_ATOMIC_STORE(&mutex->owner, NULL);
+        CO_ATOMIC_FENCE();
+        if (CO_ATOMIC_LOAD(&mutex->wait_count) == 0) {
+#if COROUTINE_MUTEX_INHERIT
+            _Mutex_Restore(self);
+#endif
+            return;
+        }
+        task = NULL;   // 已清除持有者
+    }
+    CO_TCB *related = NULL;
+#if COROUTINE_MUTEX_INHERIT
+    uint8_t inherit = MAX_PRIORITY_NUM;   // 新持有者继承的优先级
+#endif
+    CO_APP_ENTER(mutex->cs);
+    // 唤醒等待队列
+    if (!CM_NodeLink_IsEmpty(mutex->list)) {
+        MutexWaitNode *n     = CM_Field_ToType(MutexWaitNode, link, CM_NodeLink_First(mutex->list));
+        CO_TCB *       owner = task;
+        // 设置拥有者(已清除时可能被快速路径抢先获取，由其解锁时转交)
+        if (CO_ATOMIC_CAS_PTR(&mutex->owner, &owner, n->task)) {
+            CO_ATOMIC_STORE(&mutex->owner_thread, NULL);   // 新持有者未在运行
+            task         = n->task;
+            mutex->value = 1;
+            // 移除等待列表
+            CM_NodeLink_Remove(&mutex->list, &n->link);
+#if COROUTINE_MUTEX_INHERIT
+            task->wait_mutex = NULL;
+            // 剩余等待者比新持有者优先级高时继承
+            if (!CM_NodeLink_IsEmpty(mutex->list)) {
+                MutexWaitNode *w = CM_Field_ToType(MutexWaitNode, link, CM_NodeLink_First(mutex->list));
+                if (w->task->pri < task->pri)
+                    inherit = w->task->pri;
+            }
+#endif
+            // 计数等待时间
+            uint64_t tv  = n->time;
+            uint64_t now = GetMicrosecond();
+            if (now <= tv)
+                tv = 0;
+            else
+                tv = (now - tv) / 1000;
+            CO_ATOMIC_SUB(&mutex->wait_count, 1);
+            CO_Thread *c = task->coroutine;
+            CO_APP_ENTER(c->cs);
+            // 移除任务列表，延迟加入
+            related = DelTaskList(task);
+            // 清除等待标志
+            task->isWaitMutex = false;
+            // 设置执行时间
+            CO_SET_TASK_TIME(task, 0);
+            CO_APP_LEAVE(c->cs);
+            // 获取最大等待时间
+            if (mutex->max_wait_time < tv)
+                mutex->max_wait_time = tv;
+        }
+    } else if (task)
+        CO_ATOMIC_STORE(&mutex->owner, NULL);
+    CO_APP_LEAVE(mutex->cs);
+#if COROUTINE_MUTEX_INHERIT
+    if (inherit < MAX_PRIORITY_NUM)
+        _Set_Priority(task, inherit, false);
+    _Mutex_Restore(self);
+#endif
+    if (related) _Wake_Task(related);   // 唤醒新持有者
+    return;
+}
+#endif
+
+// --------------------------------------------------------------------------------------
+//                              |       读写锁        |
+// --------------------------------------------------------------------------------------
+
+#if COROUTINE_ENABLE_RWLOCK
+/**
+ * @brief    创建读写锁
+ * @param    name           名称
+ * @param    isWriterFirst  写优先：有写者等待时新读者排队
+ * @return   Coroutine_RWLock
+ * @date     2026-10-18
+ */
+static Coroutine_RWLock CreateRWLock(const char *name, bool isWriterFirst)
+{
+    size_t     size = sizeof(CO_RWLock) + sizeof(CO_RWLockReader) * Inter.thread_count;
+    CO_RWLock *rw   = (CO_RWLock *)Inter.Malloc(size, __FILE__, __LINE__);
+    if (rw == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, size);
+    memset(rw, 0, size);
+    rw->isWriterFirst = isWriterFirst;
+    rw->reader_num    = Inter.thread_count;
+    int s             = name == NULL ? 0 : strlen(name);
+    if (s > sizeof(rw->name) - 1) s = sizeof(rw->name) - 1;
+    memcpy(rw->name, name, s);
+    rw->name[s] = '\0';
+    // 加入列表
+    CO_APP_ENTER(C_Static.cs_mutexes);
+    CM_NodeLink_Insert(&C_Static.rwlocks, CM_NodeLink_End(C_Static.rwlocks), &rw->link);
+    CO_APP_LEAVE(C_Static.cs_mutexes);
+    return rw;
+}
+
+static void DeleteRWLock(Coroutine_RWLock rw)
+{
+    if (rw == NULL)
+        return;
+    CO_APP_ENTER(rw->cs);
+    if (!CM_NodeLink_IsEmpty(rw->list) || CO_ATOMIC_LOAD(&rw->writer) != NULL)
+        ERROR_RWLOCK_DELETE(rw);
+    CO_APP_LEAVE(rw->cs);
+    // 移除列表
+    CO_APP_ENTER(C_Static.cs_mutexes);
+    CM_NodeLink_Remove(&C_Static.rwlocks, &rw->link);
+    CO_APP_LEAVE(C_Static.cs_mutexes);
+    Inter.Free(rw, __FILE__, __LINE__);
+    return;
+}
+
+/**
+ * @brief    读者总数
+ * @note     任务在持有读锁期间可能迁移到其他控制器，单个计数可能为负，只有总和有意义
+ * @date     2026-10-18
+ */
+static int32_t _RWLock_Readers(CO_RWLock *rw)
+{
+    int32_t n = 0;
+    for (uint16_t i = 0; i < rw->reader_num; i++)
+        n += CO_ATOMIC_LOAD(&rw->readers[i].count);
+    return n;
+}
+
+/**
+ * @brief    唤醒等待任务(移出等待列表由调用者处理)
+ * @param    task           等待任务
+ * @param    tasks          延迟唤醒列表
+ * @note     需持有 rw->cs
+ * @date     2026-10-18
+ */
+static void _RWLock_WakeTask(CO_TCB *task, CM_NodeLinkList_t *tasks)
+{
+    CO_Thread *c = task->coroutine;
+    CO_APP_ENTER(c->cs);
+    // 移除任务列表，延迟加入
+    CO_TCB *related = DelTaskList(task);
+    // 清除等待标志
+    task->isWaitRWLock = false;
+    // 设置执行时间
+    CO_SET_TASK_TIME(task, 0);
+    CO_APP_LEAVE(c->cs);
+    if (related)
+        CM_NodeLink_Insert(tasks, CM_NodeLink_End(*tasks), &related->run_link);
+    return;
+}
+
+/**
+ * @brief    唤醒排队的任务
+ * @note     写优先且有写者排队时只唤醒第一个写者，否则唤醒全部读者(没有读者时唤醒第一个写者)；
+ *           被唤醒的任务重新竞争，需持有 rw->cs
+ * @date     2026-10-18
+ */
+static void _RWLock_WakeWaiters(CO_RWLock *rw, CM_NodeLinkList_t *tasks)
+{
+    RWLockWaitNode *writer = NULL;
+    bool            isRead = false;
+    CM_NodeLink_Foreach_Positive(RWLockWaitNode, link, rw->list, p)
+    {
+        if (p->isWrite) {
+            if (writer == NULL) writer = p;
+        } else
+            isRead = true;
+    }
+    if (writer != NULL && (rw->isWriterFirst || !isRead)) {
+        CM_NodeLink_Remove(&rw->list, &writer->link);
+        rw->wait_count--;
+        _RWLock_WakeTask(writer->task, tasks);
+        return;
+    }
+    CM_NodeLink_t *p = CM_NodeLink_First(rw->list);
+    for (uint32_t i = rw->wait_count; i; i--) {
+        RWLockWaitNode *n = CM_Field_ToType(RWLockWaitNode, link, p);
+        p                 = p->next;
+        if (n->isWrite)
+            continue;
+        CM_NodeLink_Remove(&rw->list, &n->link);
+        rw->wait_count--;
+        _RWLock_WakeTask(n->task, tasks);
+    }
+    return;
+}
+
+/**
+ * @brief    写者等待读者退出时，最后一个读者唤醒写者
+ * @note     需持有 rw->cs
+ * @date     2026-10-18
+ */
+static void _RWLock_Drained(CO_RWLock *rw, CM_NodeLinkList_t *tasks)
+{
+    if (!rw->isDrain || _RWLock_Readers(rw) != 0)
+        return;
+    rw->isDrain = false;
+    _RWLock_WakeTask(CO_ATOMIC_LOAD(&rw->writer), tasks);
+    return;
+}
+
+// 唤醒延迟列表中的任务
+static void _RWLock_WakeList(CM_NodeLinkList_t *tasks)
+{
+    while (!CM_NodeLink_IsEmpty(*tasks)) {
+        CO_TCB *task = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(*tasks));
+        CM_NodeLink_Remove(tasks, &task->run_link);
+        _Wake_Task(task);
+    }
+    return;
+}
+
+/**
+ * @brief    读者退出
+ * @param    rw             读写锁
+ * @param    c              当前控制器
+ * @param    tasks          NULL：内部加锁唤醒写者，否则调用者持有 rw->cs，写者加入该列表
+ * @note     先减计数再检查写者，与写者(先占用再统计读者)配对，不会漏掉唤醒
+ * @date     2026-10-18
+ */
+static void _RWLock_ReadLeave(CO_RWLock *rw, CO_Thread *c, CM_NodeLinkList_t *tasks)
+{
+    CO_ATOMIC_SUB(&rw->readers[c->co_id].count, 1);
+    CO_ATOMIC_FENCE();
+    if (CO_ATOMIC_LOAD(&rw->writer) == NULL)
+        return;
+    if (tasks != NULL) {
+        _RWLock_Drained(rw, tasks);
+        return;
+    }
+    CM_NodeLinkList_t list = NULL;
+    CO_APP_ENTER(rw->cs);
+    _RWLock_Drained(rw, &list);
+    CO_APP_LEAVE(rw->cs);
+    _RWLock_WakeList(&list);
+    return;
+}
+
+/**
+ * @brief    尝试获取读锁(无锁)
+ * @param    tasks          同 _RWLock_ReadLeave
+ * @return   true           获取成功
+ * @date     2026-10-18
+ */
+static bool _RWLock_TryRead(CO_RWLock *rw, CO_Thread *c, CM_NodeLinkList_t *tasks)
+{
+    if (CO_ATOMIC_LOAD(&rw->writer) != NULL || (rw->isWriterFirst && CO_ATOMIC_LOAD(&rw->writer_wait)))
+        return false;
+    CO_ATOMIC_ADD(&rw->readers[c->co_id].count, 1);
+    CO_ATOMIC_FENCE();
+    if (CO_ATOMIC_LOAD(&rw->writer) == NULL)
+        return true;
+    // 写者已占用，退出(写者可能正在等待读者退出)
+    _RWLock_ReadLeave(rw, c, tasks);
+    return false;
+}
+
+/**
+ * @brief    查找任务持有的读锁
+ * @param    isNew          没有时返回空闲项
+ * @return   CO_RWLockHold* NULL：没有(isNew 时表示持有的读锁已满)
+ * @date     2026-10-18
+ */
+static CO_RWLockHold *_RWLock_Hold(CO_TCB *task, CO_RWLock *rw, bool isNew)
+{
+    CO_RWLockHold *idle = NULL;
+    for (int i = 0; i < COROUTINE_RWLOCK_HOLDS; i++) {
+        CO_RWLockHold *h = &task->rwlock_holds[i];
+        if (h->rw == rw)
+            return h;
+        if (h->rw == NULL && idle == NULL)
+            idle = h;
+    }
+    return isNew ? idle : NULL;
+}
+
+// 记录最大等待时间 ms，需持有 rw->cs
+#define CO_RWLOCK_WAIT_TIME(rw, start)                                   \
+    do {                                                                 \
+        uint32_t __tv = (uint32_t)((GetMicrosecond() - (start)) / 1000); \
+        if ((rw)->max_wait_time < __tv)                                  \
+            (rw)->max_wait_time = __tv;                                  \
+    } while (false)
+
+/**
+ * @brief    获取读锁
+ * @param    rw             读写锁
+ * @param    timeout        超时 us
+ * @return   true           获取成功
+ * @note     没有写者时只修改当前控制器的读者计数，不进入临界区
+ * @date     2026-10-18
+ */
+static bool ReadLockUs(Coroutine_RWLock rw, uint64_t timeout)
+{
+    CO_Thread *c = _GetCurrentThread(-1, false);
+    if (rw == NULL || c == NULL || c->idx_task == NULL)
+        return false;
+    CO_TCB *       task = c->idx_task;
+    CO_RWLockHold *hold = _RWLock_Hold(task, rw, true);
+    if (hold == NULL)
+        return false;   // 持有的读锁已满
+    if (hold->count != 0) {
+        // 递归读：已计入读者，写者正在等待也直接获取(否则等待自己退出)
+        hold->count++;
+        return true;
+    }
+    // 快速路径
+    if (_RWLock_TryRead(rw, c, NULL)) {
+        hold->rw    = rw;
+        hold->count = 1;
+        return true;
+    }
+    bool           isOk = false;
+    uint64_t       now  = GetMicrosecond();
+    RWLockWaitNode wait;
+    CM_ZERO(&wait);
+    wait.task = task;
+    do {
+        // 计算剩余等待时间
+        uint64_t tv = GetMicrosecond() - now;
+        if (tv >= timeout)
+            tv = 0;
+        else
+            tv = timeout - tv;
+        CM_NodeLinkList_t tasks = NULL;
+        CO_APP_ENTER(rw->cs);
+        if (_RWLock_TryRead(rw, task->coroutine, &tasks)) {
+            CO_RWLOCK_WAIT_TIME(rw, now);
+            isOk = true;
+        } else {
+            // 加入等待列表
+            CM_NodeLink_Insert(&rw->list, CM_NodeLink_End(rw->list), &wait.link);
+            rw->wait_count++;
+            c = task->coroutine;
+            CO_APP_ENTER(c->cs);
+            task->isWaitRWLock = true;
+            CO_SET_TASK_TIME(task, tv);
+            CO_APP_LEAVE(c->cs);
+        }
+        CO_APP_LEAVE(rw->cs);
+        _RWLock_WakeList(&tasks);
+        if (isOk) {
+            hold->rw    = rw;
+            hold->count = 1;
+            return true;
+        }
+        // 等待
+        _Yield(NULL);
+        CO_APP_ENTER(rw->cs);
+        c = task->coroutine;
+        CO_APP_ENTER(c->cs);
+        if (task->isWaitRWLock) {
+            // 超时，移除等待列表
+            task->isWaitRWLock = false;
+            CM_NodeLink_Remove(&rw->list, &wait.link);
+            rw->wait_count--;
+        }
+        CO_APP_LEAVE(c->cs);
+        CO_APP_LEAVE(rw->cs);
+    } while (GetMicrosecond() - now < timeout);
+    return false;
+}
+
+static bool ReadLock(Coroutine_RWLock rw, uint32_t timeout)
+{
+    return ReadLockUs(rw, CO_MS_TO_US(timeout));
+}
+
+/**
+ * @brief    获取写锁(不可递归)
+ * @param    rw             读写锁
+ * @param    timeout        超时 us
+ * @return   true           获取成功
+ * @note     先占用写者(阻止新读者)，再等待已有读者全部退出
+ * @date     2026-10-18
+ */
+static bool WriteLockUs(Coroutine_RWLock rw, uint64_t timeout)
+{
+    CO_Thread *c = _GetCurrentThread(-1, false);
+    if (rw == NULL || c == NULL || c->idx_task == NULL)
+        return false;
+    CO_TCB *       task    = c->idx_task;
+    bool           isOk    = false;
+    bool           isOwner = false;   // 已占用写者
+    bool           isCount = false;   // 已计入等待写者
+    uint64_t       now     = GetMicrosecond();
+    RWLockWaitNode wait;
+    CM_ZERO(&wait);
+    wait.task    = task;
+    wait.isWrite = true;
+    if (CO_ATOMIC_LOAD(&rw->writer) == task || _RWLock_Hold(task, rw, false) != NULL)
+        return false;   // 不可递归，持有读锁时不可升级(等待自己退出)
+    do {
+        // 计算剩余等待时间
+        uint64_t tv = GetMicrosecond() - now;
+        if (tv >= timeout)
+            tv = 0;
+        else
+            tv = timeout - tv;
+        CO_APP_ENTER(rw->cs);
+        CO_TCB *owner = NULL;
+        if (!isOwner && CO_ATOMIC_CAS_PTR(&rw->writer, &owner, task))
+            isOwner = true;
+        if (isOwner) {
+            CO_ATOMIC_FENCE();
+            if (_RWLock_Readers(rw) == 0) {
+                CO_RWLOCK_WAIT_TIME(rw, now);
+                isOk = true;
+            } else
+                rw->isDrain = true;   // 等待读者退出，由最后一个读者唤醒
+        } else {
+            // 加入等待列表
+            CM_NodeLink_Insert(&rw->list, CM_NodeLink_End(rw->list), &wait.link);
+            rw->wait_count++;
+            if (!isCount) {
+                CO_ATOMIC_ADD(&rw->writer_wait, 1);
+                isCount = true;
+            }
+        }
+        if (!isOk) {
+            c = task->coroutine;
             CO_APP_ENTER(c->cs);
-            // 设置等待标志
-            task->isWaitSem = true;
-            // 设置超时
+            task->isWaitRWLock = true;
             CO_SET_TASK_TIME(task, tv);
             CO_APP_LEAVE(c->cs);
         }
-        CO_APP_LEAVE(sem->cs);
-        if (isOk) {
-            // 已经获取到信号，直接返回
-            return true;
-        }
+        CO_APP_LEAVE(rw->cs);
+        if (isOk) break;
         // 等待
         _Yield(NULL);
-        CO_APP_ENTER(sem->cs);
-        if (n->isOk)
-            isOk = true;
+        CO_APP_ENTER(rw->cs);
         c = task->coroutine;
         CO_APP_ENTER(c->cs);
-        if (task->isWaitSem) {
-            task->isWaitSem = false;
-            // 移除等待列表
-            CM_NodeLink_Remove(&sem->list, &n->link);
-            // 设置计数器
-            sem->wait_count--;
+        if (task->isWaitRWLock) {
+            // 超时
+            task->isWaitRWLock = false;
+            if (isOwner)
+                rw->isDrain = false;
+            else {
+                CM_NodeLink_Remove(&rw->list, &wait.link);
+                rw->wait_count--;
+            }
         }
         CO_APP_LEAVE(c->cs);
-        CO_APP_LEAVE(sem->cs);
-    } while (!isOk && GetMillisecond() - now < timeout);
+        CO_APP_LEAVE(rw->cs);
+    } while (GetMicrosecond() - now < timeout);
+    if (!isCount && isOk)
+        return true;
+    CM_NodeLinkList_t tasks = NULL;
+    CO_APP_ENTER(rw->cs);
+    if (isCount)
+        CO_ATOMIC_SUB(&rw->writer_wait, 1);
+    if (!isOk) {
+        // 超时，放弃写者并唤醒因此排队的任务
+        if (isOwner)
+            CO_ATOMIC_STORE(&rw->writer, NULL);
+        if (CO_ATOMIC_LOAD(&rw->writer) == NULL)
+            _RWLock_WakeWaiters(rw, &tasks);
+    }
+    CO_APP_LEAVE(rw->cs);
+    _RWLock_WakeList(&tasks);
     return isOk;
 }
+
+static bool WriteLock(Coroutine_RWLock rw, uint32_t timeout)
+{
+    return WriteLockUs(rw, CO_MS_TO_US(timeout));
+}
+
+/**
+ * @brief    释放读写锁(当前任务持有写锁时释放写锁，否则释放读锁)
+ * @param    rw             读写锁
+ * @date     2026-10-18
+ */
+static void UnlockRWLock(Coroutine_RWLock rw)
+{
+    CO_Thread *c = _GetCurrentThread(-1, false);
+    if (rw == NULL || c == NULL || c->idx_task == NULL)
+        return;
+    CO_TCB *task = c->idx_task;
+    if (CO_ATOMIC_LOAD_RELAXED(&rw->writer) != task) {
+        CO_RWLockHold *hold = _RWLock_Hold(task, rw, false);
+        if (hold == NULL) {
+            // 既不是写者也没有持有该锁的读锁
+            ERROR_RWLOCK_RELIEVE(task, rw);
+            return;
+        }
+        if (--hold->count == 0) {
+            hold->rw = NULL;
+            _RWLock_ReadLeave(rw, c, NULL);
+        }
+        return;
+    }
+    CM_NodeLinkList_t tasks = NULL;
+    CO_APP_ENTER(rw->cs);
+    CO_ATOMIC_STORE(&rw->writer, NULL);
+    _RWLock_WakeWaiters(rw, &tasks);
+    CO_APP_LEAVE(rw->cs);
+    _RWLock_WakeList(&tasks);
+    return;
+}
 #endif
 
 // --------------------------------------------------------------------------------------
-//                              |       互斥        |
+//                              |       事件组        |
 // --------------------------------------------------------------------------------------
 
-#if COROUTINE_ENABLE_MUTEX
-static Coroutine_Mutex CreateMutex(const char *name)
+#if COROUTINE_ENABLE_EVENT_GROUP
+/**
+ * @brief    创建事件组
+ * @param    name           名称
+ * @return   Coroutine_EventGroup
+ * @date     2026-10-18
+ */
+static Coroutine_EventGroup CreateEventGroup(const char *name)
 {
-    CO_Mutex *mutex = (CO_Mutex *)Inter.Malloc(sizeof(CO_Mutex), __FILE__, __LINE__);
-    if (mutex == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, sizeof(CO_Mutex));
-    memset(mutex, 0, sizeof(CO_Mutex));
+    CO_EventGroup *g = (CO_EventGroup *)Inter.Malloc(sizeof(CO_EventGroup), __FILE__, __LINE__);
+    if (g == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, sizeof(CO_EventGroup));
+    CM_ZERO(g);
     int s = name == NULL ? 0 : strlen(name);
-    if (s > sizeof(mutex->name) - 1) s = sizeof(mutex->name) - 1;
-    memcpy(mutex->name, name, s);
-    mutex->name[s] = '\0';
+    if (s > sizeof(g->name) - 1) s = sizeof(g->name) - 1;
+    memcpy(g->name, name, s);
+    g->name[s] = '\0';
     // 加入列表
     CO_APP_ENTER(C_Static.cs_mutexes);
-    CM_NodeLink_Insert(&C_Static.mutexes, CM_NodeLink_End(C_Static.mutexes), &mutex->link);
+    CM_NodeLink_Insert(&C_Static.event_groups, CM_NodeLink_End(C_Static.event_groups), &g->link);
     CO_APP_LEAVE(C_Static.cs_mutexes);
-    return mutex;
+    return g;
 }
 
-static void DeleteMutex(Coroutine_Mutex mutex)
+static void DeleteEventGroup(Coroutine_EventGroup g)
 {
-    if (mutex == NULL)
+    if (g == NULL)
         return;
-    CO_APP_ENTER(mutex->cs);
-    if (!CM_NodeLink_IsEmpty(mutex->list))
-        ERROR_MUTEX_DELETE(mutex);
-    CO_APP_LEAVE(mutex->cs);
+    CO_APP_ENTER(g->cs);
+    if (g->wait_count)
+        ERROR_EVENT_DELETE(g);
+    CO_APP_LEAVE(g->cs);
     // 移除列表
     CO_APP_ENTER(C_Static.cs_mutexes);
-    CM_NodeLink_Remove(&C_Static.mutexes, &mutex->link);
+    CM_NodeLink_Remove(&C_Static.event_groups, &g->link);
     CO_APP_LEAVE(C_Static.cs_mutexes);
-    Inter.Free(mutex, __FILE__, __LINE__);
+    Inter.Free(g, __FILE__, __LINE__);
     return;
 }
 
-static bool LockMutex(Coroutine_Mutex mutex, uint32_t timeout)
+// 等待条件是否满足
+#define CO_EVENT_MATCH(n, v) ((n)->isAll ? ((v) & (n)->mask) == (n)->mask : ((v) & (n)->mask) != 0)
+
+/**
+ * @brief    挂入等待节点 【需要CO_APP_ENTER(g->cs)】
+ * @param    value          当前事件位
+ * @note     等待任意位：挂入每一位；等待全部位：只挂入最低的未置位位，该位置位时再检查
+ * @date     2026-10-18
+ */
+static void _Event_Link(CO_EventGroup *g, EventWaitNode *n, uint64_t value)
+{
+    uint64_t bits = n->mask;
+    if (n->isAll) {
+        bits &= ~value;
+        if (bits == 0) bits = n->mask;   // 已全部置位(调用者随后重新检查)
+        bits &= ~(bits - 1);
+    }
+    n->link_num = 0;
+    while (bits) {
+        EventWaitLink *l = &n->links[n->link_num++];
+        l->node          = n;
+        l->bit           = CO_BITMAP64_FIRST(bits);
+        bits &= bits - 1;
+        CM_NodeLink_Insert(&g->lists[l->bit], CM_NodeLink_End(g->lists[l->bit]), &l->link);
+        CO_ATOMIC_OR(&g->wait_mask, (uint64_t)1 << l->bit);
+    }
+    return;
+}
+
+/**
+ * @brief    移除等待节点 【需要CO_APP_ENTER(g->cs)】
+ * @date     2026-10-18
+ */
+static void _Event_Unlink(CO_EventGroup *g, EventWaitNode *n)
+{
+    for (uint8_t i = 0; i < n->link_num; i++) {
+        EventWaitLink *l = &n->links[i];
+        CM_NodeLink_Remove(&g->lists[l->bit], &l->link);
+        if (CM_NodeLink_IsEmpty(g->lists[l->bit]))
+            CO_ATOMIC_AND(&g->wait_mask, ~((uint64_t)1 << l->bit));
+    }
+    n->link_num = 0;
+    return;
+}
+
+/**
+ * @brief    尝试获取事件(无锁)
+ * @return   uint64_t       命中的位 0：不满足
+ * @note     清除命中的位时用 CAS 在最新的事件位上重新检查，等待者和置位者同时消费时只有一方成功
+ * @date     2026-10-18
+ */
+static uint64_t _Event_Try(CO_EventGroup *g, EventWaitNode *n)
+{
+    uint64_t value = CO_ATOMIC_LOAD(&g->value);
+    while (CO_EVENT_MATCH(n, value)) {
+        if (!n->isClear || CO_ATOMIC_CAS(&g->value, &value, value & ~n->mask))
+            return value & n->mask;
+    }
+    return 0;
+}
+
+/**
+ * @brief    设置事件位
+ * @param    g              事件组
+ * @param    bits           事件位
+ * @return   uint64_t       设置前的事件位
+ * @note     先置位再检查等待位，与等待者(先挂入再检查事件位)配对，不会漏掉唤醒；
+ *           只遍历 bits 中有等待者的位列表；逐个等待者用 _Event_Try 检查并消费，不使用快照
+ * @date     2026-10-18
+ */
+static uint64_t SetEventBits(Coroutine_EventGroup g, uint64_t bits)
+{
+    if (g == NULL || bits == 0)
+        return 0;
+    uint64_t old = CO_ATOMIC_OR(&g->value, bits);
+    CO_ATOMIC_FENCE();
+    if ((CO_ATOMIC_LOAD(&g->wait_mask) & bits) == 0) {
+#if COROUTINE_ENABLE_PRINT_INFO
+        CO_ATOMIC_ADD(&g->fast_count, 1);
+#endif
+        return old;
+    }
+    CM_NodeLinkList_t tasks  = NULL;
+    uint64_t          relink = 0;   // 等待全部位的等待者换挂的位
+    uint64_t          now    = GetMicrosecond();
+    CO_APP_ENTER(g->cs);
+    uint64_t pend = bits & CO_ATOMIC_LOAD(&g->value) & CO_ATOMIC_LOAD(&g->wait_mask);
+    while (pend) {
+        uint8_t bit = CO_BITMAP64_FIRST(pend);
+        pend &= pend - 1;
+        // 取出该位列表逐个检查，未满足的重新挂入
+        CM_NodeLinkList_t list = g->lists[bit];
+        g->lists[bit]          = NULL;
+        while (!CM_NodeLink_IsEmpty(list)) {
+            EventWaitLink *l = CM_Field_ToType(EventWaitLink, link, CM_NodeLink_First(list));
+            EventWaitNode *n = l->node;
+            CM_NodeLink_Remove(&list, &l->link);
+            CM_NodeLink_Insert(&g->lists[bit], CM_NodeLink_End(g->lists[bit]), &l->link);
+            // 在最新的事件位上检查(快速路径的等待者和其他置位者可能已消费)
+            uint64_t result = _Event_Try(g, n);
+            if (result == 0) {
+                uint64_t value = CO_ATOMIC_LOAD(&g->value);
+                if (n->isAll && (value & ((uint64_t)1 << bit)) != 0) {
+                    // 换挂到下一个未置位的位
+                    _Event_Unlink(g, n);
+                    _Event_Link(g, n, value);
+                    relink |= (uint64_t)1 << n->links[0].bit;
+                }
+                continue;
+            }
+            n->result = result;
+            _Event_Unlink(g, n);
+            g->wait_count--;
+            uint32_t tv = (uint32_t)((now - n->time) / 1000);
+            if (g->max_wait_time < tv)
+                g->max_wait_time = tv;
+            // 移除任务列表，延迟唤醒
+            CO_TCB *   task = n->task;
+            CO_Thread *c    = task->coroutine;
+            CO_APP_ENTER(c->cs);
+            CO_TCB *related   = DelTaskList(task);
+            task->isWaitEvent = false;
+            CO_SET_TASK_TIME(task, 0);
+            CO_APP_LEAVE(c->cs);
+            if (related)
+                CM_NodeLink_Insert(&tasks, CM_NodeLink_End(tasks), &related->run_link);
+        }
+        if (CM_NodeLink_IsEmpty(g->lists[bit]))
+            CO_ATOMIC_AND(&g->wait_mask, ~((uint64_t)1 << bit));
+        else
+            CO_ATOMIC_OR(&g->wait_mask, (uint64_t)1 << bit);
+        if (pend == 0 && relink != 0) {
+            // 换挂的位可能已被并发置位(置位者没看到等待位)，重新检查
+            CO_ATOMIC_FENCE();
+            pend   = relink & CO_ATOMIC_LOAD(&g->value);
+            relink = 0;
+        }
+    }
+    CO_APP_LEAVE(g->cs);
+    // 唤醒任务
+    while (!CM_NodeLink_IsEmpty(tasks)) {
+        CO_TCB *task = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(tasks));
+        CM_NodeLink_Remove(&tasks, &task->run_link);
+        _Wake_Task(task);
+    }
+    return old;
+}
+
+static uint64_t ClearEventBits(Coroutine_EventGroup g, uint64_t bits)
+{
+    if (g == NULL)
+        return 0;
+    return CO_ATOMIC_AND(&g->value, ~bits);
+}
+
+static uint64_t GetEventBits(Coroutine_EventGroup g)
+{
+    if (g == NULL)
+        return 0;
+    return CO_ATOMIC_LOAD(&g->value);
+}
+
+/**
+ * @brief    等待事件位
+ * @param    g              事件组
+ * @param    mask           等待的位
+ * @param    isAll          等待全部位
+ * @param    isClear        满足时清除命中的位
+ * @param    timeout        超时 us
+ * @return   uint64_t       命中的位 0：超时
+ * @note     条件已满足时不进入临界区
+ * @date     2026-10-18
+ */
+static uint64_t WaitEventBitsUs(Coroutine_EventGroup g, uint64_t mask, bool isAll, bool isClear, uint64_t timeout)
 {
     CO_Thread *c = _GetCurrentThread(-1, false);
-    if (mutex == NULL || c == NULL || c->idx_task == NULL)
-        return false;
-    CO_TCB *      task = c->idx_task;
-    bool          isOk = false;
-    uint64_t      now  = GetMillisecond();
-    MutexWaitNode wait;
-    CM_ZERO(&wait);
-    wait.task = task;
+    if (g == NULL || mask == 0 || c == NULL || c->idx_task == NULL)
+        return 0;
+    EventWaitNode wait;
+    wait.task     = c->idx_task;
+    wait.mask     = mask;
+    wait.result   = 0;
+    wait.isAll    = isAll;
+    wait.isClear  = isClear;
+    wait.link_num = 0;
+    wait.links    = wait.inline_links;
+    // 快速路径
+    uint64_t ret = _Event_Try(g, &wait);
+    if (ret != 0 || timeout == 0)
+        return ret;
+    // 等待任意位时每一位一个索引
+    uint8_t num = 1;
+    if (!isAll) {
+        num = 0;
+        for (uint64_t m = mask; m; m &= m - 1)
+            num++;
+    }
+    if (num > EVENT_WAIT_LINKS) {
+        wait.links = (EventWaitLink *)Inter.Malloc(num * sizeof(EventWaitLink), __FILE__, __LINE__);
+        if (wait.links == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, num * sizeof(EventWaitLink));
+    }
+    CO_TCB * task = wait.task;
+    uint64_t now  = GetMicrosecond();
+    wait.time     = now;
     do {
         // 计算剩余等待时间
-        uint64_t tv = GetMillisecond() - now;
-        if (tv >= (uint64_t)timeout)
+        uint64_t tv = GetMicrosecond() - now;
+        if (tv >= timeout)
             tv = 0;
         else
             tv = timeout - tv;
-        CO_APP_ENTER(mutex->cs);
-        MutexWaitNode *wait_mutex = &wait;
-        if (mutex->owner == task) {
-            // 已经锁定
-            mutex->value++;
-            isOk = true;
-        } else if (mutex->owner == NULL) {
-            // 获取锁
-            mutex->owner      = task;
-            mutex->value      = 1;
-            wait_mutex->mutex = mutex;
-            isOk              = true;
-        } else {
-            // 等待锁
-            CM_NodeLink_Insert(&mutex->list, CM_NodeLink_End(mutex->list), &wait_mutex->link);
-            wait_mutex->mutex = mutex;
-            wait_mutex->time  = now;
-            mutex->wait_count++;
+        CO_APP_ENTER(g->cs);
+        while (true) {
+            _Event_Link(g, &wait, CO_ATOMIC_LOAD(&g->value));
+            CO_ATOMIC_FENCE();
+            ret = _Event_Try(g, &wait);
+            if (ret != 0 || !isAll || (CO_ATOMIC_LOAD(&g->value) & ((uint64_t)1 << wait.links[0].bit)) == 0)
+                break;
+            // 挂入的位已被置位，换一个
+            _Event_Unlink(g, &wait);
+        }
+        if (ret != 0)
+            _Event_Unlink(g, &wait);
+        else {
+            g->wait_count++;
+            c = task->coroutine;
             CO_APP_ENTER(c->cs);
-            // 设置等待标志
-            task->isWaitMutex = true;
-            // 设置超时
+            task->isWaitEvent = true;
             CO_SET_TASK_TIME(task, tv);
             CO_APP_LEAVE(c->cs);
         }
-        CO_APP_LEAVE(mutex->cs);
-        if (isOk) return true;   // 获取锁成功
+        CO_APP_LEAVE(g->cs);
+        if (ret != 0) break;
         // 等待
         _Yield(NULL);
-        CO_APP_ENTER(mutex->cs);
-        // 移除等待列表
-        CM_NodeLink_Remove(&mutex->list, &wait_mutex->link);
+        CO_APP_ENTER(g->cs);
         c = task->coroutine;
         CO_APP_ENTER(c->cs);
-        if (task->isWaitMutex) {
-            mutex->wait_count--;
-            task->isWaitMutex = false;
+        if (task->isWaitEvent) {
+            // 超时，移除等待列表
+            task->isWaitEvent = false;
+            _Event_Unlink(g, &wait);
+            g->wait_count--;
         }
         CO_APP_LEAVE(c->cs);
-        isOk = mutex->owner == task;
-        CO_APP_LEAVE(mutex->cs);
-    } while (!isOk && (GetMillisecond() - now) < timeout);
-    return isOk;
+        CO_APP_LEAVE(g->cs);
+        ret = wait.result;
+    } while (ret == 0 && GetMicrosecond() - now < timeout);
+    if (wait.links != wait.inline_links)
+        Inter.Free(wait.links, __FILE__, __LINE__);
+    return ret;
 }
 
-static void UnlockMutex(Coroutine_Mutex mutex)
+static uint64_t WaitEventBits(Coroutine_EventGroup g, uint64_t mask, bool isAll, bool isClear, uint32_t timeout)
 {
-    CO_Thread *c = _GetCurrentThread(-1, false);
-    if (mutex == NULL || c == NULL || c->idx_task == NULL)
-        return;
-    CO_TCB *task    = c->idx_task;
-    bool    isOk    = false;
-    CO_TCB *related = NULL;
-    CO_APP_ENTER(mutex->cs);
-    if (mutex->owner == task) {
-        // 解锁
-        mutex->value--;
-        if (mutex->value == 0) {
-            // 清除拥有者
-            mutex->owner = NULL;
-            // 唤醒等待队列
-            if (!CM_NodeLink_IsEmpty(mutex->list)) {
-                MutexWaitNode *n = CM_Field_ToType(MutexWaitNode, link, CM_NodeLink_First(mutex->list));
-                task             = n->task;
-                // 移除等待列表
-                CM_NodeLink_Remove(&mutex->list, &n->link);
-                // 计数等待时间
-                uint64_t tv  = n->time;
-                uint64_t now = GetMillisecond();
-                if (now <= tv)
-                    tv = 0;
-                else
-                    tv = now - tv;
-                // 设置拥有者
-                mutex->owner = task;
-                mutex->value = 1;
-                mutex->wait_count--;
-                CO_Thread *c = task->coroutine;
-                CO_APP_ENTER(c->cs);
-                // 移除任务列表，延迟加入
-                related = DelTaskList(task);
-                // 清除等待标志
-                task->isWaitMutex = false;
-                // 设置执行时间
-                CO_SET_TASK_TIME(task, 0);
-                CO_APP_LEAVE(c->cs);
-                // 获取最大等待时间
-                if (mutex->max_wait_time < tv)
-                    mutex->max_wait_time = tv;
-                isOk = true;
-            }
-        }
-    } else
-        ERROR_MUTEX_RELIEVE(task, mutex);   // 解锁异常
-    CO_APP_LEAVE(mutex->cs);
-    if (isOk) _Yield(related);   // 转移控制权
-    return;
+    return WaitEventBitsUs(g, mask, isAll, isClear, CO_MS_TO_US(timeout));
 }
 #endif
 
@@ -2144,7 +5084,8 @@ static Coroutine_Handle Coroutine_Create(size_t id)
     CM_ZERO(c);
     c->isRun = false;
 #if COROUTINE_ENABLE_PRINT_INFO
-    c->schedule_start_time = c->task_start_time = c->start_time = GetMillisecond();
+    c->schedule_start_time = c->start_time = GetMillisecond();
+    c->task_start_time                     = GetMicrosecond();
 #endif
     c->ThreadId = id;
     CO_EnterCriticalSection();
@@ -2153,32 +5094,44 @@ static Coroutine_Handle Coroutine_Create(size_t id)
     return c;
 }
 
-static uint64_t GetMillisecond(void)
+/**
+ * @brief    获取运行微秒值(单调递增)
+ * @note     Inter.GetMicrosecond 为 NULL 时由 Inter.GetMillisecond 换算；
+ *           控制器线程以本控制器缓存的 now 钳位保证不回退，不写共享数据；
+ *           不支持线程局部变量时不钳位，要求时钟源单调
+ * @return   uint64_t
+ * @date     2026-10-17
+ */
+static uint64_t GetMicrosecond(void)
 {
-    static uint64_t ts  = 0;
-    uint64_t        now = 0;
-#if COROUTINE_BLOCK_CRITICAL_SECTION
-    if (CO_APP_TRY_ENTER(C_Static.cs_get_time)) {
-        now = Inter.GetMillisecond();
-        if (now > ts)
-            ts = now;   // 修正时间值延迟
-        else
-            now = ts;
-        CO_APP_LEAVE(C_Static.cs_get_time);
-    } else
-        now = ts;
-#else
-    uint64_t now = Inter.GetMillisecond();
-    CO_APP_ENTER(C_Static.cs_get_time);
-    if (now > ts)
-        ts = now;   // 修正时间值延迟
-    else
-        now = ts;
-    CO_APP_LEAVE(C_Static.cs_get_time);
-#endif
+    uint64_t   now = Inter.GetMicrosecond ? Inter.GetMicrosecond() : CO_MS_TO_US(Inter.GetMillisecond());
+    CO_Thread *c   = _Bound_Thread();
+    if (c == NULL)
+        return now;
+    if (now < c->now)
+        return c->now;   // 修正时间值延迟
+    c->now = now;
     return now;
 }
 
+/**
+ * @brief    获取当前控制器缓存的微秒值(每轮调度刷新一次)
+ * @note     不超过精确时间，误差为当前任务本轮已运行的时间；
+ *           不在控制器线程中调用时读取精确时间。计算超时截止时间使用 GetMicrosecond
+ * @return   uint64_t
+ * @date     2026-10-17
+ */
+static uint64_t GetCoarseMicrosecond(void)
+{
+    CO_Thread *c = _GetCurrentThread(-1, false);
+    return c != NULL && c->now ? c->now : GetMicrosecond();
+}
+
+static uint64_t GetMillisecond(void)
+{
+    return GetMicrosecond() / 1000;
+}
+
 static void *Malloc(size_t      size,
                     const char *file,
                     int         line)
@@ -2207,6 +5160,7 @@ static int __watchdogs_cm_rbtree_callback_compare(const CM_RBTree_t *     tree,
     return TREE_RIGHT;
 }
 
+#if !COROUTINE_SLEEP_WHEEL
 static int __tasks_sleep_cm_rbtree_callback_compare(const CM_RBTree_t *     tree,
                                                     const CM_RBTree_Link_t *new_val,
                                                     const CM_RBTree_Link_t *val)
@@ -2217,6 +5171,7 @@ static int __tasks_sleep_cm_rbtree_callback_compare(const CM_RBTree_t *     tree
         return TREE_LEFT;
     return TREE_RIGHT;
 }
+#endif
 
 static void SetInter(const Coroutine_Inter *inter)
 {
@@ -2231,25 +5186,151 @@ static void SetInter(const Coroutine_Inter *inter)
         C_Static.coroutines[i]        = Coroutine_Create((size_t)-1);
         C_Static.coroutines[i]->co_id = i;
     }
-    C_Static.run_list = (CO_TaskRunList *)Inter.Malloc(inter->thread_count * sizeof(CO_TaskRunList), __FILE__, __LINE__);
-    memset(C_Static.run_list, 0, inter->thread_count * sizeof(CO_TaskRunList));
+    // 创建就绪队列
+    C_Static.run_list = (CO_TaskRunList *)Inter.Malloc(inter->thread_count * MAX_PRIORITY_NUM * sizeof(CO_TaskRunList), __FILE__, __LINE__);
+    if (C_Static.run_list == NULL) ERROR_MEMORY_ALLOC(__FILE__, __LINE__, inter->thread_count * MAX_PRIORITY_NUM * sizeof(CO_TaskRunList));
+    memset(C_Static.run_list, 0, inter->thread_count * MAX_PRIORITY_NUM * sizeof(CO_TaskRunList));
+    for (uint16_t i = 0; i < inter->thread_count; i++) {
+        C_Static.coroutines[i]->run_list  = &C_Static.run_list[i * MAX_PRIORITY_NUM];
+        C_Static.coroutines[i]->rand_seed = 0x9E3779B9u * (i + 1);
+#if COROUTINE_WAKE_INBOX
+        C_Static.coroutines[i]->inbox_tail = C_Static.coroutines[i]->inbox_head = &C_Static.coroutines[i]->inbox_stub;
+#endif
+    }
     // 初始化看门狗列表
     CM_RBTree_Init(&C_Static.watchdogs, __watchdogs_cm_rbtree_callback_compare);
     // 默认堆栈大小
     C_Static.def_stack_size = coroutine_get_stack_default_size();
     // 创建休眠列表
+#if !COROUTINE_SLEEP_WHEEL
     CM_RBTree_Init(&C_Static.tasks_sleep, __tasks_sleep_cm_rbtree_callback_compare);
+#endif
+    C_Static.sleep_deadline = UINT64_MAX;
+    C_Static.placement      = COROUTINE_PLACEMENT;
+    // 初始启用的控制器，其余等待 AddController
+    C_Static.ThreadInitNum = Inter.thread_init == 0 || Inter.thread_init > Inter.thread_count ? Inter.thread_count : Inter.thread_init;
+    C_Static.ThreadOpenNum = C_Static.ActiveNum = C_Static.ThreadInitNum;
+    for (uint16_t i = C_Static.ThreadInitNum; i < Inter.thread_count; i++)
+        C_Static.coroutines[i]->isRetired = 1;
+    // NUMA 节点分组
+    C_Static.node_count = 1;
+    for (uint16_t i = 0; i < Inter.thread_count && Inter.GetNode != NULL; i++) {
+        C_Static.coroutines[i]->node = Inter.GetNode(i);
+        if (C_Static.coroutines[i]->node >= C_Static.node_count)
+            C_Static.node_count = C_Static.coroutines[i]->node + 1;
+    }
+    C_Static.delay_co_id = 0xFFFF;
     // 初始化完成，启动线程
     for (uint16_t i = 0; i < inter->thread_count; i++)
         C_Static.coroutines[i]->isRun = true;
-    // 添加初始任务
-    Coroutine_Register_Task_Run();
+    // 添加初始任务(默认实例)
+#if COROUTINE_MULTI_INSTANCE
+    if (co_sched == &co_default)
+#endif
+        Coroutine_Register_Task_Run();
     return;
 }
 
+#if COROUTINE_MULTI_INSTANCE
+static Coroutine_Instance CreateInstance(const Coroutine_Inter *inter)
+{
+    struct _CO_Sched *inst = (struct _CO_Sched *)inter->Malloc(sizeof(struct _CO_Sched), __FILE__, __LINE__);
+    if (inst == NULL)
+        return NULL;
+    memset(inst, 0, sizeof(struct _CO_Sched));
+    struct _CO_Sched *prev = co_sched;
+    co_sched               = inst;
+    SetInter(inter);
+    co_sched = prev;
+    return inst;
+}
+
+static bool DeleteInstance(Coroutine_Instance inst)
+{
+    if (inst == NULL || inst == &co_default)
+        return false;
+    struct _CO_Sched *prev = co_sched;
+    co_sched               = inst;
+    bool isOk              = CM_NodeLink_IsEmpty(C_Static.task_list) &&
+                CM_NodeLink_IsEmpty(C_Static.semaphores) &&
+                CM_NodeLink_IsEmpty(C_Static.mailboxes) &&
+                CM_NodeLink_IsEmpty(C_Static.mutexes) &&
+                CM_NodeLink_IsEmpty(C_Static.rwlocks) &&
+                CM_NodeLink_IsEmpty(C_Static.event_groups) &&
+                CM_NodeLink_IsEmpty(C_Static.channels);
+    if (isOk) {
+#if COROUTINE_TASK_POOL_SIZE
+        // 释放任务缓存
+        for (int i = 0; i < TASK_POOL_CLASS; i++) {
+            TaskPool *pool = &C_Static.task_pool[i];
+            while (!CM_NodeLink_IsEmpty(pool->tasks)) {
+                CO_TCB *t = CM_Field_ToType(CO_TCB, run_link, CM_NodeLink_First(pool->tasks));
+                CM_NodeLink_Remove(&pool->tasks, &t->run_link);
+                _Destroy_Task(t);
+            }
+            pool->count = 0;
+        }
+#endif
+        // 释放控制器
+        for (uint16_t i = 0; i < Inter.thread_count; i++) {
+            CM_NodeLink_Remove(&C_Static.threads, &C_Static.coroutines[i]->link);
+            Inter.Free(C_Static.coroutines[i], __FILE__, __LINE__);
+        }
+        Inter.Free(C_Static.coroutines, __FILE__, __LINE__);
+        Inter.Free(C_Static.run_list, __FILE__, __LINE__);
+    }
+    co_sched = prev == inst ? &co_default : prev;
+    if (isOk && tls_sched == inst)
+        tls_sched = NULL;   // 本线程缓存的控制器已释放
+    if (isOk)
+        inst->inter.Free(inst, __FILE__, __LINE__);
+    return isOk;
+}
+
+static Coroutine_Instance SelectInstance(Coroutine_Instance inst)
+{
+    struct _CO_Sched *prev = co_sched;
+    co_sched               = inst == NULL ? &co_default : inst;
+    return prev;
+}
+#endif
+
 static const char *GetTaskName(Coroutine_TaskId taskId)
 {
-    return taskId == NULL || taskId->name == NULL ? "" : taskId->name;
+    return taskId == NULL ? "" : taskId->name;
+}
+
+static bool SetTaskPriority(Coroutine_TaskId taskId, uint8_t pri)
+{
+    CO_TCB *task = taskId == NULL ? Coroutine_GetTaskId() : taskId;
+    if (task == NULL || pri >= MAX_PRIORITY_NUM)
+        return false;
+    _Set_Priority(task, pri, true);
+    return true;
+}
+
+static bool SetTaskAffinity(Coroutine_TaskId taskId, Coroutine_Affinity mask, bool isHard)
+{
+    CO_TCB *task = taskId == NULL ? Coroutine_GetTaskId() : taskId;
+    if (task == NULL)
+        return false;
+    if (Inter.thread_count < COROUTINE_AFFINITY_BITS)
+        mask &= ((Coroutine_Affinity)1 << Inter.thread_count) - 1;
+    CO_Thread *c = NULL;
+    while (true) {
+        c = task->coroutine;
+        CO_APP_ENTER(c->cs);
+        if (c == task->coroutine)
+            break;
+        CO_APP_LEAVE(c->cs);   // 任务已被其他控制器取走，重新获取
+    }
+    task->affinity       = mask;
+    task->isAffinityHard = isHard && mask != 0;
+    CO_APP_LEAVE(c->cs);
+    // 当前任务不在允许的控制器上，让出后由调度转移
+    if (task == Coroutine_GetTaskId() && !_Affinity_Allowed(task, c))
+        Coroutine_Yield();
+    return true;
 }
 
 // --------------------------------------------------------------------------------------
@@ -2349,7 +5430,7 @@ static void FeedDog(uint32_t time)
     if (time == 0)
         task->watchdog->expiration_time = 0;
     else
-        task->watchdog->expiration_time = GetMillisecond() + time;
+        task->watchdog->expiration_time = GetMicrosecond() + CO_MS_TO_US(time);
     if (task->watchdog->expiration_time) {
         // 添加到新的列表
         CO_APP_ENTER(C_Static.cs_watchdogs);
@@ -2411,7 +5492,7 @@ static void DeleteChannel(Coroutine_Channel ch)
     return;
 }
 
-static bool WriteChannel(Coroutine_Channel ch, uint64_t data, uint32_t timeout)
+static bool WriteChannelUs(Coroutine_Channel ch, uint64_t data, uint64_t timeout)
 {
     if (ch == NULL)
         return false;
@@ -2421,13 +5502,13 @@ static bool WriteChannel(Coroutine_Channel ch, uint64_t data, uint32_t timeout)
     CO_TCB *        task    = c->idx_task;
     CO_TCB *        related = NULL;
     bool            isOk    = false;
-    uint64_t        now     = GetMillisecond();
+    uint64_t        now     = GetMicrosecond();
     ChannelWaitNode tmp;
     tmp.isOk = false;
     do {
         // 计算剩余等待时间
-        uint64_t tv = GetMillisecond() - now;
-        if (tv >= (uint64_t)timeout)
+        uint64_t tv = GetMicrosecond() - now;
+        if (tv >= timeout)
             tv = 0;
         else
             tv = timeout - tv;
@@ -2488,11 +5569,16 @@ static bool WriteChannel(Coroutine_Channel ch, uint64_t data, uint32_t timeout)
         CO_APP_LEAVE(task->coroutine->cs);
         isOk = tmp.isOk;
         CO_APP_LEAVE(ch->cs);
-    } while (!isOk && (GetMillisecond() - now) < timeout);
+    } while (!isOk && (GetMicrosecond() - now) < timeout);
     return isOk;
 }
 
-static bool ReadChannel(Coroutine_Channel ch, uint64_t *data, uint32_t timeout)
+static bool WriteChannel(Coroutine_Channel ch, uint64_t data, uint32_t timeout)
+{
+    return WriteChannelUs(ch, data, CO_MS_TO_US(timeout));
+}
+
+static bool ReadChannelUs(Coroutine_Channel ch, uint64_t *data, uint64_t timeout)
 {
     if (ch == NULL || data == NULL)
         return false;
@@ -2502,13 +5588,13 @@ static bool ReadChannel(Coroutine_Channel ch, uint64_t *data, uint32_t timeout)
     CO_TCB *        task    = c->idx_task;
     CO_TCB *        related = NULL;
     bool            isOk    = false;
-    uint64_t        now     = GetMillisecond();
+    uint64_t        now     = GetMicrosecond();
     ChannelWaitNode tmp;
     tmp.isOk = false;
     do {
         // 计算剩余等待时间
-        uint64_t tv = GetMillisecond() - now;
-        if (tv >= (uint64_t)timeout)
+        uint64_t tv = GetMicrosecond() - now;
+        if (tv >= timeout)
             tv = 0;
         else
             tv = timeout - tv;
@@ -2573,9 +5659,14 @@ static bool ReadChannel(Coroutine_Channel ch, uint64_t *data, uint32_t timeout)
             isOk  = true;
         }
         CO_APP_LEAVE(ch->cs);
-    } while (!isOk && (GetMillisecond() - now) < timeout);
+    } while (!isOk && (GetMicrosecond() - now) < timeout);
     return isOk;
 }
+
+static bool ReadChannel(Coroutine_Channel ch, uint64_t *data, uint32_t timeout)
+{
+    return ReadChannelUs(ch, data, CO_MS_TO_US(timeout));
+}
 #endif
 
 // --------------------------------------------------------------------------------------
@@ -2708,19 +5799,32 @@ static const Universal *GetUniversal(void)
 
 const _Coroutine Coroutine = {
     SetInter,
+#if COROUTINE_MULTI_INSTANCE
+    CreateInstance,
+    DeleteInstance,
+    SelectInstance,
+#endif
     Coroutine_AddTask,
+    Coroutine_AddTaskPlacement,
+    SetPlacement,
     Coroutine_GetTaskId,
     GetCurrentCoroutineIdx,
     _GetThreadId,
     Coroutine_Yield,
     Coroutine_YieldTimeOut,
+    Coroutine_YieldTimeOutUs,
     Coroutine_RunTick,
+    Coroutine_RunTicks,
     Coroutine_MillisecondInterrupt,
+    AddController,
+    RetireController,
+    GetControllerInfo,
 #if COROUTINE_ENABLE_MAILBOX
     CreateMailbox,
     DeleteMailbox,
     SendMail,
     ReceiveMail,
+    ReceiveMailUs,
 #endif
 #if COROUTINE_ENABLE_PRINT_INFO
     PrintInfo,
@@ -2730,17 +5834,40 @@ const _Coroutine Coroutine = {
     DeleteSemaphore,
     GiveSemaphore,
     WaitSemaphore,
+    WaitSemaphoreUs,
 #endif
 #if COROUTINE_ENABLE_MUTEX
     CreateMutex,
     DeleteMutex,
     LockMutex,
+    LockMutexUs,
     UnlockMutex,
+#endif
+#if COROUTINE_ENABLE_RWLOCK
+    CreateRWLock,
+    DeleteRWLock,
+    ReadLock,
+    ReadLockUs,
+    WriteLock,
+    WriteLockUs,
+    UnlockRWLock,
+#endif
+#if COROUTINE_ENABLE_EVENT_GROUP
+    CreateEventGroup,
+    DeleteEventGroup,
+    SetEventBits,
+    ClearEventBits,
+    GetEventBits,
+    WaitEventBits,
+    WaitEventBitsUs,
 #endif
     GetMillisecond,
+    GetMicrosecond,
     Malloc,
     Free,
     GetTaskName,
+    SetTaskPriority,
+    SetTaskAffinity,
 #if COROUTINE_ENABLE_ASYNC
     ASync,
     ASyncWait,
@@ -2758,5 +5885,7 @@ const _Coroutine Coroutine = {
     DeleteChannel,
     WriteChannel,
     ReadChannel,
+    WriteChannelUs,
+    ReadChannelUs,
 #endif
 };
@@ -97,6 +97,51 @@ extern "C" {
 #endif
 #endif
 
+// 分块临界区自旋锁类型 0：TTAS + 指数退避 1：排队(ticket)锁，先到先得
+// ticket 锁公平但要求控制器独占 CPU(线程数多于核数时排队者被抢占会拖住后面所有等待者)
+#ifndef COROUTINE_CS_TICKET
+#define COROUTINE_CS_TICKET 0
+#endif
+// 分块临界区竞争统计(获取次数、冲突次数、自旋次数)，PrintInfo 显示
+#ifndef COROUTINE_CS_STATS
+#define COROUTINE_CS_STATS 0
+#endif
+// 周期事件(Inter.events->Period)最小间隔 us，0：每运行一个任务触发一次
+#ifndef COROUTINE_PERIOD_US
+#define COROUTINE_PERIOD_US 0
+#endif
+// 跨控制器唤醒通过无锁收件箱(多生产者单消费者)，不占用目标控制器临界区；只由所属控制器转入，需要 park/unpark 事件
+#ifndef COROUTINE_WAKE_INBOX
+#define COROUTINE_WAKE_INBOX COROUTINE_BLOCK_CRITICAL_SECTION
+#endif
+// 软亲和任务在就绪队列等待超过该时间(ms)后允许被掩码外的控制器窃取
+#ifndef COROUTINE_AFFINITY_SOFT_MS
+#define COROUTINE_AFFINITY_SOFT_MS 2
+#endif
+// 控制器亲和掩码位宽 32 或 64，co_id 不小于该值的控制器不在任何掩码中(设置了亲和的任务不会在其上运行)
+#ifndef COROUTINE_AFFINITY_BITS
+#define COROUTINE_AFFINITY_BITS 32
+#endif
+// 新任务默认分配策略 Coroutine_Placement_t
+#ifndef COROUTINE_PLACEMENT
+#define COROUTINE_PLACEMENT 2
+#endif
+// 线程局部变量缓存当前线程的控制器(编译器不支持 TLS 时关闭，按线程id查找)
+#ifndef COROUTINE_THREAD_LOCAL
+#if defined(_ARMABI)
+#define COROUTINE_THREAD_LOCAL 0
+#else
+#define COROUTINE_THREAD_LOCAL 1
+#endif
+#endif
+// 多调度实例(CreateInstance)：调度状态按线程选择的实例访问(线程局部变量)，0：只有默认实例
+#ifndef COROUTINE_MULTI_INSTANCE
+#define COROUTINE_MULTI_INSTANCE 0
+#endif
+#if COROUTINE_MULTI_INSTANCE && !COROUTINE_THREAD_LOCAL
+#error "COROUTINE_MULTI_INSTANCE requires COROUTINE_THREAD_LOCAL"
+#endif
+
 // 任务调度时进行栈检查，会增加调度时间开销但能及时发现栈溢出的错误，适用于开发阶段
 #ifndef COROUTINE_CHECK_STACK
 #define COROUTINE_CHECK_STACK 0
@@ -113,6 +158,26 @@ extern "C" {
 #ifndef COROUTINE_ENABLE_MUTEX
 #define COROUTINE_ENABLE_MUTEX 1
 #endif
+// 互斥锁竞争时的自旋次数(只在持有者正在其他控制器运行时自旋)，0：直接挂起
+#ifndef COROUTINE_MUTEX_SPIN
+#define COROUTINE_MUTEX_SPIN 1000
+#endif
+// 互斥锁优先级继承：等待列表按优先级排序，持有者(沿等待链传递)提升到最高等待者优先级，解锁时恢复
+#ifndef COROUTINE_MUTEX_INHERIT
+#define COROUTINE_MUTEX_INHERIT 1
+#endif
+// 启用读写锁
+#ifndef COROUTINE_ENABLE_RWLOCK
+#define COROUTINE_ENABLE_RWLOCK 1
+#endif
+// 每个任务可同时持有读锁的读写锁数量(同一把锁递归读只占一个)
+#ifndef COROUTINE_RWLOCK_HOLDS
+#define COROUTINE_RWLOCK_HOLDS 4
+#endif
+// 启用事件组
+#ifndef COROUTINE_ENABLE_EVENT_GROUP
+#define COROUTINE_ENABLE_EVENT_GROUP 1
+#endif
 // 启用异步任务
 #ifndef COROUTINE_ENABLE_ASYNC
 #define COROUTINE_ENABLE_ASYNC 1
@@ -129,12 +194,36 @@ extern "C" {
 #ifndef COROUTINE_ENABLE_PRINT_INFO
 #define COROUTINE_ENABLE_PRINT_INFO 1
 #endif
+// 任务缓存：每种栈大小缓存已结束任务的 TCB、栈和看门狗节点数量，0：不缓存
+#ifndef COROUTINE_TASK_POOL_SIZE
+#if defined(_ARMABI)
+#define COROUTINE_TASK_POOL_SIZE 0
+#else
+#define COROUTINE_TASK_POOL_SIZE 64
+#endif
+#endif
+// 休眠列表：1 分层时间轮(插入/取消 O(1)，批量到期)，0 红黑树
+#ifndef COROUTINE_SLEEP_WHEEL
+#if defined(_ARMABI)
+#define COROUTINE_SLEEP_WHEEL 0
+#else
+#define COROUTINE_SLEEP_WHEEL 1
+#endif
+#endif
+// 时间轮刻度 2^n us，休眠最多延后一个刻度唤醒
+#ifndef COROUTINE_SLEEP_WHEEL_SHIFT
+#define COROUTINE_SLEEP_WHEEL_SHIFT 7
+#endif
+// 优先级饥饿上限(ms)：低优先级任务就绪等待超过该时间时先于高优先级运行，0：禁用(严格优先级)
+#ifndef COROUTINE_PRIORITY_STARVATION_MS
+#define COROUTINE_PRIORITY_STARVATION_MS 0
+#endif
 
 // -------------- 独立栈协程 --------------
 // 优点：切换速度快
 // 缺点：占用内存大，容易造成栈溢出，某个任务都需要分配较大的栈空间
 
-#define COROUTINE_VERSION "1.23"
+#define COROUTINE_VERSION "1.48"
 
 typedef struct _CO_Thread *   Coroutine_Handle;      // 协程实例
 typedef struct _CO_TCB *      Coroutine_TaskId;      // 任务id
@@ -142,7 +231,17 @@ typedef struct _CO_Semaphore *Coroutine_Semaphore;   // 信号量
 typedef struct _CO_Mailbox *  Coroutine_Mailbox;     // 邮箱
 typedef struct _CO_ASync *    Coroutine_ASync;       // 异步任务
 typedef struct _CO_Mutex *    Coroutine_Mutex;       // 互斥锁(可递归)
+typedef struct _CO_RWLock *   Coroutine_RWLock;      // 读写锁(不可递归)
+typedef struct _CO_EventGroup *Coroutine_EventGroup; // 事件组(64 位事件标志)
 typedef struct _CO_Channel *  Coroutine_Channel;     // 管道(！！！不能在协程以外的地方使用！！！)
+typedef struct _CO_Sched *    Coroutine_Instance;    // 调度实例
+#if COROUTINE_AFFINITY_BITS == 64
+typedef uint64_t Coroutine_Affinity;   // 控制器亲和掩码 bit n: co_id n
+#elif COROUTINE_AFFINITY_BITS == 32
+typedef uint32_t Coroutine_Affinity;   // 控制器亲和掩码 bit n: co_id n
+#else
+#error "COROUTINE_AFFINITY_BITS must be 32 or 64"
+#endif
 
 typedef enum
 {
@@ -152,8 +251,33 @@ typedef enum
     CO_ERR_MEMORY_ALLOC     = 3,   // 内存分配失败
     CO_ERR_SEM_DELETE       = 4,   // 信号量删除错误 有任务正在等待
     CO_ERR_MUTEX_DELETE     = 5,   // 互斥锁删除错误 有任务正在等待
+    CO_ERR_RWLOCK_DELETE    = 6,   // 读写锁删除错误 有任务正在等待或持有写锁
+    CO_ERR_RWLOCK_RELIEVE   = 7,   // 读写锁释放错误 未持有该读写锁
+    CO_ERR_EVENT_DELETE     = 8,   // 事件组删除错误 有任务正在等待
 } Coroutine_ErrEvent_t;
 
+typedef enum
+{
+    CO_PLACE_DEFAULT     = 0,   // 默认策略(SetPlacement 设置)
+    CO_PLACE_ROUND_ROBIN = 1,   // 轮询
+    CO_PLACE_TWO_CHOICE  = 2,   // 随机选两个控制器，取运行数量少的
+    CO_PLACE_LOCAL       = 3,   // 当前控制器(协程外调用时按 CO_PLACE_TWO_CHOICE)
+} Coroutine_Placement_t;
+
+/**
+ * @brief    控制器状态(用于伸缩决策)
+ * @date     2026-10-17
+ */
+typedef struct
+{
+    bool     isActive;     // 已启用(未退役)
+    bool     isBound;      // 已绑定线程
+    uint16_t node;         // 所在 NUMA 节点(Inter.GetNode)
+    uint32_t run_count;    // 就绪任务数量
+    uint64_t run_time;     // 启动以来的时间 ms
+    uint64_t sleep_time;   // 累计空闲时间 ms(需要 COROUTINE_ENABLE_PRINT_INFO，否则为 0)
+} Coroutine_ControllerInfo;
+
 /**
  * @brief    错误事件参数
  * @author   CXS (chenxiangshu@outlook.com)
@@ -195,6 +319,22 @@ typedef union
     {
         Coroutine_Mutex mutex;
     } mutex_delete;
+    // CO_ERR_RWLOCK_DELETE
+    struct
+    {
+        Coroutine_RWLock rwlock;
+    } rwlock_delete;
+    // CO_ERR_RWLOCK_RELIEVE
+    struct
+    {
+        Coroutine_TaskId taskId;
+        Coroutine_RWLock rwlock;   // 读写锁
+    } rwlock_relieve;
+    // CO_ERR_EVENT_DELETE
+    struct
+    {
+        Coroutine_EventGroup group;
+    } event_delete;
 } Coroutine_ErrPars_t;
 
 // 任务回调
@@ -203,8 +343,14 @@ typedef void (*Coroutine_Task)(void *obj);
 typedef void (*Coroutine_Period_Event)(void *object);
 // 空闲事件（可用于低功耗休眠）
 typedef void (*Coroutine_Idle_Event)(uint32_t time, void *object);
+// 空闲事件 us（time 为距下一个到期任务的时间，UINT64_MAX：直到被唤醒）
+typedef void (*Coroutine_IdleUs_Event)(uint64_t time, void *object);
 // 线程空闲唤醒
 typedef void (*Coroutine_Wake_Event)(void *object);
+// 控制器停放（co_id 所在线程休眠 time us，UINT64_MAX：直到 unpark；先 unpark 后 park 时立即返回）
+typedef void (*Coroutine_Park_Event)(uint16_t co_id, uint64_t time, void *object);
+// 唤醒停放的控制器
+typedef void (*Coroutine_Unpark_Event)(uint16_t co_id, void *object);
 // 异步任务
 typedef void *(*Coroutine_AsyncTask)(void *arg);
 // 错误事件
@@ -226,6 +372,9 @@ typedef struct
     Coroutine_Idle_Event   Idle;     // 空闲事件
     Coroutine_Wake_Event   wake;     // 唤醒事件
     Coroutine_Error_Event  error;    // 错误事件
+    Coroutine_IdleUs_Event IdleUs;   // 空闲事件 us（可选，优先于 Idle）
+    Coroutine_Park_Event   park;     // 控制器停放（可选，与 unpark 同时提供，优先于 Idle/wake）
+    Coroutine_Unpark_Event unpark;   // 唤醒指定控制器
 } Coroutine_Events;
 
 // 协程接口
@@ -283,6 +432,68 @@ typedef struct
      * @date     2024-06-28
      */
     Coroutine_Events *events;
+
+    /**
+     * @brief    分配任务栈【可选，NULL 使用 Malloc】
+     * @param    size           [in]需要的字节数 [out]实际可用字节数
+     * @return   void*          栈底(低地址)，NULL 时改用 Malloc
+     * @note     实现可使用保护页和按需提交，不需要预先填充
+     * @date     2026-10-17
+     */
+    void *(*AllocStack)(size_t *size);
+
+    /**
+     * @brief    释放任务栈【可选，与 AllocStack 成对设置】
+     * @param    stack          AllocStack 返回的栈
+     * @param    size           AllocStack 输出的字节数
+     * @date     2026-10-17
+     */
+    void (*FreeStack)(void *stack, size_t size);
+
+    /**
+     * @brief    统计栈使用量【可选，NULL 不统计 AllocStack 分配的栈】
+     * @param    stack          AllocStack 返回的栈
+     * @param    size           AllocStack 输出的字节数
+     * @return   size_t         栈最大使用字节数(高水位)
+     * @date     2026-10-17
+     */
+    size_t (*StackUsage)(const void *stack, size_t size);
+
+    /**
+     * @brief    获取运行微秒值【可选，NULL 使用 GetMillisecond 换算】
+     * @note     用于休眠、超时、看门狗等全部定时，建议使用单调时钟
+     * @date     2026-10-17
+     */
+    uint64_t (*GetMicrosecond)(void);
+
+    size_t thread_init;   // 初始启用的控制器数量【可选，0：thread_count】，其余由 AddController 启用
+
+    /**
+     * @brief    获取控制器所在的 NUMA 节点【可选，NULL：单节点】
+     * @param    co_id          控制器id
+     * @return   uint16_t       节点 从0开始
+     * @note     多个节点时窃取先查看本节点的控制器，任务栈绑定到运行控制器所在节点
+     * @date     2026-10-17
+     */
+    uint16_t (*GetNode)(uint16_t co_id);
+
+    /**
+     * @brief    控制器线程首次调度时在该线程中调用【可选】
+     * @param    co_id          控制器id
+     * @param    node           GetNode 返回的节点
+     * @note     用于将线程绑定到节点的 CPU 和内存
+     * @date     2026-10-17
+     */
+    void (*BindThread)(uint16_t co_id, uint16_t node);
+
+    /**
+     * @brief    将任务栈内存绑定到 NUMA 节点【可选，单节点时不调用】
+     * @param    mem            栈
+     * @param    size           字节数
+     * @param    node           节点
+     * @date     2026-10-17
+     */
+    void (*BindMemory)(void *mem, size_t size, uint16_t node);
 } Coroutine_Inter;
 
 typedef struct
@@ -303,6 +514,38 @@ typedef struct
      */
     void (*SetInter)(const Coroutine_Inter *inter);
 
+#if COROUTINE_MULTI_INSTANCE
+    /**
+     * @brief    【外部使用】创建调度实例
+     * @param    inter          实例的外部接口(控制器数量、事件等独立，events->object 区分实例)
+     * @return   Coroutine_Instance
+     * @note     每个实例有独立的控制器、就绪队列、休眠列表、看门狗和对象列表；
+     *           对象(信号量、邮箱等)属于创建时选择的实例，不能跨实例使用
+     * @date     2026-10-17
+     */
+    Coroutine_Instance (*CreateInstance)(const Coroutine_Inter *inter);
+
+    /**
+     * @brief    【外部使用】删除调度实例
+     * @param    inst           调度实例(不能是默认实例)
+     * @return   true           成功
+     * @return   false          还有任务或对象未删除
+     * @note     调用前需停止实例的控制器线程(不再调用 RunTick/RunTicks)
+     * @date     2026-10-17
+     */
+    bool (*DeleteInstance)(Coroutine_Instance inst);
+
+    /**
+     * @brief    【外部使用】选择当前线程使用的调度实例
+     * @param    inst           调度实例 NULL：默认实例(SetInter 设置)
+     * @return   Coroutine_Instance  之前选择的实例
+     * @note     控制器线程在第一次 RunTick 前选择，之后不能更换；
+     *           其他线程选择后调用的接口(AddTask、GiveSemaphore 等)作用于该实例
+     * @date     2026-10-17
+     */
+    Coroutine_Instance (*SelectInstance)(Coroutine_Instance inst);
+#endif
+
     /**
      * @brief    添加协程任务
      * @param    func           执行函数
@@ -322,6 +565,33 @@ typedef struct
                                 const char *      name,
                                 Coroutine_TaskId *taskId);
 
+    /**
+     * @brief    添加协程任务(指定分配策略)
+     * @param    func           执行函数
+     * @param    pars           执行参数
+     * @param    pri            任务优先级
+     * @param    stack_size     任务栈大小
+     * @param    name           协程名称
+     * @param    placement      分配策略 CO_PLACE_DEFAULT：使用默认策略
+     * @param    taskId         任务id
+     * @return   Coroutine_TaskId NULL：创建失败
+     * @date     2026-10-17
+     */
+    Coroutine_TaskId (*AddTaskPlacement)(Coroutine_Task        func,
+                                         void *                pars,
+                                         uint8_t               pri,
+                                         uint32_t              stack_size,
+                                         const char *          name,
+                                         Coroutine_Placement_t placement,
+                                         Coroutine_TaskId *    taskId);
+
+    /**
+     * @brief    设置新任务默认分配策略
+     * @param    placement      分配策略 CO_PLACE_DEFAULT：恢复 COROUTINE_PLACEMENT
+     * @date     2026-10-17
+     */
+    void (*SetPlacement)(Coroutine_Placement_t placement);
+
     /**
      * @brief    获取当前任务id
      * @return   Coroutine_TaskId
@@ -362,6 +632,14 @@ typedef struct
      */
     uint32_t (*YieldDelay)(uint32_t timeout);
 
+    /**
+     * @brief    【内部使用】转交控制权(微秒)
+     * @param    timeout        超时 us 0：不超时
+     * @return   uint64_t       多耗时的部分 us
+     * @date     2026-10-17
+     */
+    uint64_t (*YieldDelayUs)(uint64_t timeout);
+
     /**
      * @brief    【外部使用】运行协程(一次运行一个任务)
      * @param    c              协程实例
@@ -373,13 +651,55 @@ typedef struct
      */
     bool (*RunTick)(uint32_t timeout);
 
+    /**
+     * @brief    【外部使用】批量运行协程(连续运行多个任务，减少每次调用的开销)
+     * @param    timeout        等待任务超时 0：不超时
+     * @param    max_tasks      最多运行任务数 0：不限制
+     * @param    max_us         最长运行时间 us 0：不限制
+     * @return   uint32_t       运行的任务数，0：没有就绪任务(已空闲等待一次)
+     * @note     没有就绪任务时，已运行过任务则立即返回，否则与 RunTick 一样空闲等待；
+     *           max_tasks 和 max_us 都为 0 时运行到空闲为止
+     * @date     2026-10-17
+     */
+    uint32_t (*RunTicks)(uint32_t timeout, uint32_t max_tasks, uint32_t max_us);
+
     /**
      * @brief    毫秒中断
+     * @note     控制器调度和空闲唤醒时会处理到期任务，提供 IdleUs 事件时可不调用
      * @author   CXS (chenxiangshu@outlook.com)
      * @date     2024-07-31
      */
     void (*MillisecondInterrupt)(void);
 
+    /**
+     * @brief    【外部使用】启用一个控制器
+     * @param    isNewThread    [out] true：启用的控制器尚未绑定线程，需要创建新线程调用 RunTick/RunTicks
+     * @return   int            控制器id，-1：已达到 thread_count 上限
+     * @note     优先重新启用已退役的控制器(线程仍在停放)，否则按顺序启用未绑定的控制器
+     * @date     2026-10-17
+     */
+    int (*AddController)(bool *isNewThread);
+
+    /**
+     * @brief    【外部使用】退役控制器
+     * @param    co_id          控制器id
+     * @return   true           成功
+     * @return   false          id 无效、已退役或是最后一个启用的控制器
+     * @note     不再分配新任务，就绪和之后唤醒的任务转移到启用的控制器后停放，
+     *           线程不退出，可由 AddController 重新启用
+     * @date     2026-10-17
+     */
+    bool (*RetireController)(uint16_t co_id);
+
+    /**
+     * @brief    【外部使用】获取控制器状态
+     * @param    co_id          控制器id
+     * @param    info           [out] 状态
+     * @return   true           成功
+     * @date     2026-10-17
+     */
+    bool (*GetControllerInfo)(uint16_t co_id, Coroutine_ControllerInfo *info);
+
 #if COROUTINE_ENABLE_MAILBOX
     /**
      * @brief    创建邮箱
@@ -424,6 +744,17 @@ typedef struct
     Coroutine_MailResult (*ReceiveMail)(Coroutine_Mailbox mb,
                                         uint64_t          id_Mask,
                                         uint32_t          timeout);
+
+    /**
+     * @brief    【内部使用】接收邮件(微秒超时)
+     * @param    mb             邮箱
+     * @param    id_Mask        邮件id掩码
+     * @param    timeout        接收超时 us
+     * @date     2026-10-17
+     */
+    Coroutine_MailResult (*ReceiveMailUs)(Coroutine_Mailbox mb,
+                                          uint64_t          id_Mask,
+                                          uint64_t          timeout);
 #endif
 
 #if COROUTINE_ENABLE_PRINT_INFO
@@ -485,6 +816,17 @@ typedef struct
     bool (*WaitSemaphore)(Coroutine_Semaphore _sem,
                           uint32_t            val,
                           uint32_t            timeout);
+
+    /**
+     * @brief    等待信号量(微秒超时)
+     * @param    _sem           信号量
+     * @param    val            数值
+     * @param    timeout        超时 us
+     * @date     2026-10-17
+     */
+    bool (*WaitSemaphoreUs)(Coroutine_Semaphore _sem,
+                            uint32_t            val,
+                            uint64_t            timeout);
 #endif
 
 #if COROUTINE_ENABLE_MUTEX
@@ -513,6 +855,14 @@ typedef struct
      */
     bool (*LockMutex)(Coroutine_Mutex mutex, uint32_t timeout);
 
+    /**
+     * @brief    获取互斥锁(微秒超时)
+     * @param    mutex          互斥锁
+     * @param    timeout        超时 us
+     * @date     2026-10-17
+     */
+    bool (*LockMutexUs)(Coroutine_Mutex mutex, uint64_t timeout);
+
     /**
      * @brief    释放互斥锁
      * @param    mutex          互斥锁
@@ -522,6 +872,133 @@ typedef struct
     void (*UnlockMutex)(Coroutine_Mutex mutex);
 #endif
 
+#if COROUTINE_ENABLE_RWLOCK
+    /**
+     * @brief    创建读写锁
+     * @param    name           名称 最大31字节
+     * @param    isWriterFirst  写优先：有写者排队时新读者也排队 false：读优先
+     * @return   Coroutine_RWLock
+     * @date     2026-10-18
+     */
+    Coroutine_RWLock (*CreateRWLock)(const char *name, bool isWriterFirst);
+
+    /**
+     * @brief    删除读写锁
+     * @param    rw             读写锁
+     * @date     2026-10-18
+     */
+    void (*DeleteRWLock)(Coroutine_RWLock rw);
+
+    /**
+     * @brief    获取读锁(没有写者时无锁)
+     * @param    rw             读写锁
+     * @param    timeout        超时 ms
+     * @note     已持有该锁的读锁时递归获取，不受写优先限制；
+     *           同时持有读锁的读写锁超过 COROUTINE_RWLOCK_HOLDS 时返回 false
+     * @date     2026-10-18
+     */
+    bool (*ReadLock)(Coroutine_RWLock rw, uint32_t timeout);
+
+    /**
+     * @brief    获取读锁(微秒超时)
+     * @param    rw             读写锁
+     * @param    timeout        超时 us
+     * @date     2026-10-18
+     */
+    bool (*ReadLockUs)(Coroutine_RWLock rw, uint64_t timeout);
+
+    /**
+     * @brief    获取写锁(持有写锁时不能再获取读锁或写锁，持有读锁时不能升级)
+     * @param    rw             读写锁
+     * @param    timeout        超时 ms
+     * @date     2026-10-18
+     */
+    bool (*WriteLock)(Coroutine_RWLock rw, uint32_t timeout);
+
+    /**
+     * @brief    获取写锁(微秒超时)
+     * @param    rw             读写锁
+     * @param    timeout        超时 us
+     * @date     2026-10-18
+     */
+    bool (*WriteLockUs)(Coroutine_RWLock rw, uint64_t timeout);
+
+    /**
+     * @brief    释放读写锁(持有写锁时释放写锁，否则释放读锁)
+     * @param    rw             读写锁
+     * @note     未持有该锁时报告 CO_ERR_RWLOCK_RELIEVE
+     * @date     2026-10-18
+     */
+    void (*UnlockRWLock)(Coroutine_RWLock rw);
+#endif
+
+#if COROUTINE_ENABLE_EVENT_GROUP
+    /**
+     * @brief    创建事件组
+     * @param    name           名称 最大31字节
+     * @return   Coroutine_EventGroup
+     * @date     2026-10-18
+     */
+    Coroutine_EventGroup (*CreateEventGroup)(const char *name);
+
+    /**
+     * @brief    删除事件组
+     * @param    group          事件组
+     * @date     2026-10-18
+     */
+    void (*DeleteEventGroup)(Coroutine_EventGroup group);
+
+    /**
+     * @brief    设置事件位(只唤醒等待这些位的任务)
+     * @param    group          事件组
+     * @param    bits           事件位
+     * @return   uint64_t       设置前的事件位
+     * @date     2026-10-18
+     */
+    uint64_t (*SetEventBits)(Coroutine_EventGroup group, uint64_t bits);
+
+    /**
+     * @brief    清除事件位
+     * @param    group          事件组
+     * @param    bits           事件位
+     * @return   uint64_t       清除前的事件位
+     * @date     2026-10-18
+     */
+    uint64_t (*ClearEventBits)(Coroutine_EventGroup group, uint64_t bits);
+
+    /**
+     * @brief    获取事件位
+     * @param    group          事件组
+     * @return   uint64_t       当前事件位
+     * @date     2026-10-18
+     */
+    uint64_t (*GetEventBits)(Coroutine_EventGroup group);
+
+    /**
+     * @brief    等待事件位
+     * @param    group          事件组
+     * @param    mask           等待的位
+     * @param    isAll          true：等待全部位 false：等待任意位
+     * @param    isClear        满足时清除(消费)命中的位
+     * @param    timeout        超时 ms
+     * @return   uint64_t       命中的位 0：超时
+     * @date     2026-10-18
+     */
+    uint64_t (*WaitEventBits)(Coroutine_EventGroup group, uint64_t mask, bool isAll, bool isClear, uint32_t timeout);
+
+    /**
+     * @brief    等待事件位(微秒超时)
+     * @param    group          事件组
+     * @param    mask           等待的位
+     * @param    isAll          true：等待全部位 false：等待任意位
+     * @param    isClear        满足时清除(消费)命中的位
+     * @param    timeout        超时 us
+     * @return   uint64_t       命中的位 0：超时
+     * @date     2026-10-18
+     */
+    uint64_t (*WaitEventBitsUs)(Coroutine_EventGroup group, uint64_t mask, bool isAll, bool isClear, uint64_t timeout);
+#endif
+
     /**
      * @brief    获取毫秒值
      * @return   const Coroutine_Events*
@@ -530,6 +1007,13 @@ typedef struct
      */
     uint64_t (*GetMillisecond)(void);
 
+    /**
+     * @brief    获取微秒值
+     * @note     每次读取精确时钟(单调递增)；调度器内部热路径使用每轮调度缓存的时间
+     * @date     2026-10-17
+     */
+    uint64_t (*GetMicrosecond)(void);
+
     /**
      * @brief    内存分配
      * @return   const Coroutine_Events*
@@ -559,6 +1043,27 @@ typedef struct
      */
     const char *(*GetTaskName)(Coroutine_TaskId taskId);
 
+    /**
+     * @brief    设置任务优先级(就绪中的任务会立即移动到新的优先级队列)
+     * @param    taskId         任务id NULL：当前任务
+     * @param    pri            优先级 TASK_PRI_HIGHEST ~ TASK_PRI_LOWEST
+     * @return   true           设置成功
+     * @date     2026-10-17
+     */
+    bool (*SetTaskPriority)(Coroutine_TaskId taskId, uint8_t pri);
+
+    /**
+     * @brief    设置任务控制器亲和(窃取和转移时遵守)
+     * @param    taskId         任务id NULL：当前任务
+     * @param    mask           控制器掩码 bit n: co_id n，0：不限制
+     *                          只能表示前 COROUTINE_AFFINITY_BITS 个控制器，控制器更多时需要把该值设为 64
+     * @param    isHard         true：只在掩码中的控制器运行 false：优先在掩码中的控制器运行，
+     *                          等待超过 COROUTINE_AFFINITY_SOFT_MS 时允许其他控制器窃取
+     * @return   true           设置成功
+     * @date     2026-10-17
+     */
+    bool (*SetTaskAffinity)(Coroutine_TaskId taskId, Coroutine_Affinity mask, bool isHard);
+
 #if COROUTINE_ENABLE_ASYNC
     /**
      * @brief    执行异步任务
@@ -652,6 +1157,24 @@ typedef struct
      * @date     2024-07-10
      */
     bool (*ReadChannel)(Coroutine_Channel ch, uint64_t *data, uint32_t timeout);
+
+    /**
+     * @brief    写通道数据(微秒超时)
+     * @param    ch             通道实例
+     * @param    data           写入数据
+     * @param    timeout        写入超时 us
+     * @date     2026-10-17
+     */
+    bool (*WriteChannelUs)(Coroutine_Channel ch, uint64_t data, uint64_t timeout);
+
+    /**
+     * @brief    读取通道数据(微秒超时)
+     * @param    ch             通道实例
+     * @param    data           读取数据缓存
+     * @param    timeout        读取超时 us
+     * @date     2026-10-17
+     */
+    bool (*ReadChannelUs)(Coroutine_Channel ch, uint64_t *data, uint64_t timeout);
 #endif
 } _Coroutine;
 
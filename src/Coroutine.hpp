@@ -207,6 +207,37 @@ namespace CO {
             Coroutine.YieldDelay(ms);
         }
 
+        /**
+         * @brief    【内部使用】休眠(微秒)
+         * @param    us             休眠时间 us
+         * @date     2026-10-17
+         */
+        static inline void SleepUs(uint64_t us)
+        {
+            Coroutine.YieldDelayUs(us);
+        }
+
+        /**
+         * @brief    设置当前任务优先级
+         * @param    pri            TASK_PRI_HIGHEST ~ TASK_PRI_LOWEST
+         * @date     2026-10-17
+         */
+        static inline bool SetPriority(uint8_t pri)
+        {
+            return Coroutine.SetTaskPriority(nullptr, pri);
+        }
+
+        /**
+         * @brief    设置当前任务控制器亲和
+         * @param    mask           控制器掩码 bit n: co_id n(前 COROUTINE_AFFINITY_BITS 个)，0：不限制
+         * @param    isHard         true：只在掩码中的控制器运行 false：优先
+         * @date     2026-10-17
+         */
+        static inline bool SetAffinity(Coroutine_Affinity mask, bool isHard = true)
+        {
+            return Coroutine.SetTaskAffinity(nullptr, mask, isHard);
+        }
+
         /**
          * @brief    设置默认栈大小
          * @param    size
@@ -482,6 +513,217 @@ namespace CO {
         void operator=(const Mutex *) = delete;
     };
 
+#if COROUTINE_ENABLE_RWLOCK
+    /**
+     * @brief    读写锁(不可递归)
+     * @note     {
+     * @note        CO::RWLock::ReadGuard guard(rw);
+     * @note        if (guard.IsLocked()) ...
+     * @note     }
+     * @date     2026-10-18
+     */
+    class RWLock {
+    private:
+        Coroutine_RWLock rw = nullptr;
+
+    public:
+        /**
+         * @brief    创建读写锁
+         * @param    name           名称 31 字节
+         * @param    isWriterFirst  写优先
+         * @date     2026-10-18
+         */
+        RWLock(const char *name = nullptr, bool isWriterFirst = false)
+        {
+            rw = Coroutine.CreateRWLock(name, isWriterFirst);
+        }
+
+        /**
+         * @brief    获取读锁
+         * @param    timeout        等待时间 ms
+         * @return   true           获取成功
+         * @return   false          获取超时
+         * @date     2026-10-18
+         */
+        inline bool ReadLock(uint32_t timeout = UINT32_MAX)
+        {
+            if (this->rw) return Coroutine.ReadLock(this->rw, timeout);
+            return false;
+        }
+
+        /**
+         * @brief    获取写锁
+         * @param    timeout        等待时间 ms
+         * @return   true           获取成功
+         * @return   false          获取超时
+         * @date     2026-10-18
+         */
+        inline bool WriteLock(uint32_t timeout = UINT32_MAX)
+        {
+            if (this->rw) return Coroutine.WriteLock(this->rw, timeout);
+            return false;
+        }
+
+        /**
+         * @brief    释放读锁或写锁
+         * @date     2026-10-18
+         */
+        inline void UnLock()
+        {
+            if (this->rw) Coroutine.UnlockRWLock(this->rw);
+            return;
+        }
+
+        /**
+         * @brief    作用域读锁(析构时释放)
+         * @date     2026-10-18
+         */
+        class ReadGuard {
+        private:
+            RWLock &lock;
+            bool    isLocked;
+
+        public:
+            explicit ReadGuard(RWLock &rw, uint32_t timeout = UINT32_MAX) : lock(rw)
+            {
+                isLocked = lock.ReadLock(timeout);
+            }
+            inline bool IsLocked() const { return isLocked; }
+            ~ReadGuard()
+            {
+                if (isLocked) lock.UnLock();
+            }
+            ReadGuard(const ReadGuard &)     = delete;
+            void operator=(const ReadGuard &) = delete;
+        };
+
+        /**
+         * @brief    作用域写锁(析构时释放)
+         * @date     2026-10-18
+         */
+        class WriteGuard {
+        private:
+            RWLock &lock;
+            bool    isLocked;
+
+        public:
+            explicit WriteGuard(RWLock &rw, uint32_t timeout = UINT32_MAX) : lock(rw)
+            {
+                isLocked = lock.WriteLock(timeout);
+            }
+            inline bool IsLocked() const { return isLocked; }
+            ~WriteGuard()
+            {
+                if (isLocked) lock.UnLock();
+            }
+            WriteGuard(const WriteGuard &)     = delete;
+            void operator=(const WriteGuard &) = delete;
+        };
+
+        virtual ~RWLock()
+        {
+            if (this->rw) Coroutine.DeleteRWLock(this->rw);
+            this->rw = nullptr;
+        }
+
+        void operator=(const RWLock &) = delete;
+        void operator=(const RWLock *) = delete;
+    };
+#endif
+
+#if COROUTINE_ENABLE_EVENT_GROUP
+    /**
+     * @brief    事件组(64 位事件标志)
+     * @date     2026-10-18
+     */
+    class EventGroup {
+    private:
+        Coroutine_EventGroup group = nullptr;
+
+    public:
+        /**
+         * @brief    创建事件组
+         * @param    name           名称 31 字节
+         * @date     2026-10-18
+         */
+        EventGroup(const char *name = nullptr)
+        {
+            group = Coroutine.CreateEventGroup(name);
+        }
+
+        /**
+         * @brief    设置事件位
+         * @param    bits           事件位
+         * @return   uint64_t       设置前的事件位
+         * @date     2026-10-18
+         */
+        inline uint64_t Set(uint64_t bits)
+        {
+            if (this->group) return Coroutine.SetEventBits(this->group, bits);
+            return 0;
+        }
+
+        /**
+         * @brief    清除事件位
+         * @param    bits           事件位
+         * @return   uint64_t       清除前的事件位
+         * @date     2026-10-18
+         */
+        inline uint64_t Clear(uint64_t bits)
+        {
+            if (this->group) return Coroutine.ClearEventBits(this->group, bits);
+            return 0;
+        }
+
+        /**
+         * @brief    获取事件位
+         * @date     2026-10-18
+         */
+        inline uint64_t Get()
+        {
+            if (this->group) return Coroutine.GetEventBits(this->group);
+            return 0;
+        }
+
+        /**
+         * @brief    等待任意位
+         * @param    mask           等待的位
+         * @param    isClear        满足时清除命中的位
+         * @param    timeout        等待时间 ms
+         * @return   uint64_t       命中的位 0：超时
+         * @date     2026-10-18
+         */
+        inline uint64_t WaitAny(uint64_t mask, bool isClear = false, uint32_t timeout = UINT32_MAX)
+        {
+            if (this->group) return Coroutine.WaitEventBits(this->group, mask, false, isClear, timeout);
+            return 0;
+        }
+
+        /**
+         * @brief    等待全部位
+         * @param    mask           等待的位
+         * @param    isClear        满足时清除命中的位
+         * @param    timeout        等待时间 ms
+         * @return   uint64_t       命中的位 0：超时
+         * @date     2026-10-18
+         */
+        inline uint64_t WaitAll(uint64_t mask, bool isClear = false, uint32_t timeout = UINT32_MAX)
+        {
+            if (this->group) return Coroutine.WaitEventBits(this->group, mask, true, isClear, timeout);
+            return 0;
+        }
+
+        virtual ~EventGroup()
+        {
+            if (this->group) Coroutine.DeleteEventGroup(this->group);
+            this->group = nullptr;
+        }
+
+        void operator=(const EventGroup &) = delete;
+        void operator=(const EventGroup *) = delete;
+    };
+#endif
+
     /**
      * @brief    邮箱通信（发送不会阻塞）
      * @author   CXS (chenxiangshu@outlook.com)